@@ -129,6 +129,7 @@ static my_bool opt_raw_mode= 0, opt_stop_never= 0;
 static ulong opt_stop_never_slave_server_id= 0;
 static my_bool opt_verify_binlog_checksum= 1;
 static ulonglong offset = 0;
+static ulong opt_read_ahead_size= 0;
 static char* host = 0;
 static int port= 0;
 static uint my_end_arg;
@@ -1605,6 +1606,13 @@ static struct my_option my_options[] =
   {"read-from-remote-server", 'R', "Read binary logs from a MariaDB server.",
    &remote_opt, &remote_opt, 0, GET_BOOL, NO_ARG, 0, 0, 0, 0,
    0, 0},
+  {"read-ahead-size", 0,
+   "Read the events of local binary log files, and verify their checksums, "
+   "in a separate thread, up to this many bytes ahead of the events being "
+   "decoded and printed. Not used when reading from stdin. 0 disables the "
+   "read-ahead.",
+   &opt_read_ahead_size, &opt_read_ahead_size, 0, GET_ULONG, REQUIRED_ARG,
+   0, 0, ULONG_MAX, 0, 0, 0},
   {"raw", 0, "Requires -R. Output raw binlog data instead of SQL "
    "statements. Output files named after server logs.",
    &opt_raw_mode, &opt_raw_mode, 0, GET_BOOL, NO_ARG, 0, 0, 0, 0,
@@ -2858,6 +2866,237 @@ static Exit_status check_header(IO_CACHE* file,
 }
 
 
+/**
+  Reader of the events of a local binary log, for --read-ahead-size.
+
+  A separate thread reads the events from the file and verifies their
+  checksums, while the main thread decodes and prints the events read
+  before. At most opt_read_ahead_size bytes of events are kept ahead.
+
+  The thread stops after a Start_encryption event: the events that follow
+  depend on the decryption set up by process_event(), and the main thread
+  reads them itself.
+
+  The read-ahead is only used for regular files. A thread that is blocked
+  reading a pipe, such as stdin, could not be stopped by end().
+*/
+
+class Binlog_read_ahead
+{
+  struct Event
+  {
+    Event *next;
+    uchar *buf;
+    ulong len;
+    my_off_t pos;                 /* Offset of the event in the file */
+    bool checksum_ok;             /* Verified, or not to be verified */
+  };
+
+  IO_CACHE *file;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  Event *first, **last;           /* Events read ahead, protected by lock */
+  ulong queued_bytes;
+  my_off_t end_pos;               /* Where the thread stopped */
+  int end_error;                  /* LOG_READ_EOF or the read error */
+  enum enum_binlog_checksum_alg checksum_alg;
+  bool running, stop, done, handoff;
+
+public:
+  Binlog_read_ahead(IO_CACHE *file_arg)
+    : file(file_arg), first(NULL), last(&first), queued_bytes(0),
+      end_pos(0), end_error(0), running(false), stop(false), done(false),
+      handoff(false)
+  {
+    pthread_mutex_init(&lock, NULL);
+    pthread_cond_init(&cond, NULL);
+  }
+  ~Binlog_read_ahead()
+  {
+    end();
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&cond);
+  }
+
+  void start();
+  void end();
+  void read_events();
+  Log_event *read_event(my_off_t *pos, int *read_error);
+};
+
+
+pthread_handler_t binlog_read_ahead_thread(void *arg)
+{
+  my_thread_init();
+  ((Binlog_read_ahead*) arg)->read_events();
+  my_thread_end();
+  return 0;
+}
+
+
+void Binlog_read_ahead::read_events()
+{
+  /* Events are not decrypted here, see the class comment */
+  Format_description_log_event fdle(4);
+
+  for (;;)
+  {
+    String packet;
+    my_off_t pos= my_b_tell(file);
+    int error= Log_event::read_log_event(file, &packet, &fdle,
+                                         BINLOG_CHECKSUM_ALG_OFF);
+    Event *ev= NULL;
+    if (!error &&
+        !(ev= (Event*) my_malloc(PSI_NOT_INSTRUMENTED, sizeof(Event),
+                                 MYF(MY_WME))))
+      error= LOG_READ_MEM;
+    if (unlikely(error))
+    {
+      pthread_mutex_lock(&lock);
+      end_pos= pos;
+      end_error= error;
+      done= true;
+      pthread_cond_signal(&cond);
+      pthread_mutex_unlock(&lock);
+      return;
+    }
+
+    ev->len= packet.length();
+    ev->pos= pos;
+    ev->buf= (uchar*) packet.release();
+    ev->next= NULL;
+    /* As in Log_event::read_log_event(const uchar*, ...) */
+    switch (ev->buf[EVENT_TYPE_OFFSET]) {
+    case FORMAT_DESCRIPTION_EVENT:
+      checksum_alg= get_checksum_alg(ev->buf, ev->len);
+      break;
+    case START_EVENT_V3:
+      checksum_alg= BINLOG_CHECKSUM_ALG_OFF;
+      break;
+    }
+    ev->checksum_ok= !opt_verify_binlog_checksum ||
+                     !event_checksum_test(ev->buf, ev->len, checksum_alg);
+
+    pthread_mutex_lock(&lock);
+    *last= ev;
+    last= &ev->next;
+    queued_bytes+= ev->len;
+    pthread_cond_signal(&cond);
+    if (ev->buf[EVENT_TYPE_OFFSET] == START_ENCRYPTION_EVENT)
+      handoff= done= true;
+    while (!done && !stop && queued_bytes >= opt_read_ahead_size)
+      pthread_cond_wait(&cond, &lock);
+    bool finished= done || stop;
+    pthread_mutex_unlock(&lock);
+    if (finished)
+      return;
+  }
+}
+
+
+void Binlog_read_ahead::start()
+{
+  MY_STAT stat;
+  if (my_fstat(file->file, &stat, MYF(0)) || !MY_S_ISREG(stat.st_mode))
+    return;
+  checksum_alg= glob_description_event->checksum_alg;
+  if (pthread_create(&thread, NULL, binlog_read_ahead_thread, this))
+    warning("Could not create the read-ahead thread, reading without it.");
+  else
+    running= true;
+}
+
+
+void Binlog_read_ahead::end()
+{
+  if (!running)
+    return;
+  pthread_mutex_lock(&lock);
+  stop= true;
+  pthread_cond_signal(&cond);
+  pthread_mutex_unlock(&lock);
+  pthread_join(thread, NULL);
+  running= false;
+  while (Event *ev= first)
+  {
+    first= ev->next;
+    my_free(ev->buf);
+    my_free(ev);
+  }
+  last= &first;
+  queued_bytes= 0;
+}
+
+
+/**
+  Read the next event, as Log_event::read_log_event(IO_CACHE*, ...) would.
+
+  @param[out] pos         Offset of the event in the file
+  @param[out] read_error  Set when NULL is returned on an error, not EOF
+*/
+
+Log_event *Binlog_read_ahead::read_event(my_off_t *pos, int *read_error)
+{
+  const char *error= 0;
+  Log_event *res= 0;
+
+  *read_error= 0;
+  if (running)
+  {
+    Event *ev;
+    pthread_mutex_lock(&lock);
+    while (!(ev= first) && !done)
+      pthread_cond_wait(&cond, &lock);
+    if (ev)
+    {
+      if (!(first= ev->next))
+        last= &first;
+      queued_bytes-= ev->len;
+      pthread_cond_signal(&cond);
+    }
+    pthread_mutex_unlock(&lock);
+
+    if (ev)
+    {
+      *pos= ev->pos;
+      if ((res= Log_event::read_log_event(ev->buf, ev->len, &error,
+                                          glob_description_event,
+                                          !ev->checksum_ok, false)))
+        res->register_temp_buf(ev->buf, true);
+      else
+        my_free(ev->buf);
+      my_free(ev);
+    }
+    else
+    {
+      end();
+      if (!handoff)
+      {
+        *pos= end_pos;
+        if (end_error != LOG_READ_EOF)
+        {
+          error= Log_event::read_log_event_error(end_error);
+          if (force_opt)
+            res= new Unknown_log_event();
+        }
+      }
+    }
+    if (unlikely(error))
+    {
+      *read_error= 1;
+      sql_print_error("Error in Log_event::read_log_event(): '%s'", error);
+    }
+    if (res || error || !handoff)
+      return res;
+  }
+
+  *pos= my_b_tell(file);
+  return Log_event::read_log_event(file, read_error, glob_description_event,
+                                   opt_verify_binlog_checksum);
+}
+
+
 /**
   Reads a local binlog and prints the events it sees.
 
@@ -2876,6 +3115,7 @@ static Exit_status dump_local_log_entries(PRINT_EVENT_INFO *print_event_info,
 {
   File fd = -1;
   IO_CACHE cache,*file= &cache;
+  Binlog_read_ahead read_ahead(file);
   uchar tmp_buff[BIN_LOG_HEADER_SIZE];
   Exit_status retval= OK_CONTINUE;
 
@@ -2947,15 +3187,15 @@ static Exit_status dump_local_log_entries(PRINT_EVENT_INFO *print_event_info,
     error("Failed reading from file.");
     goto err;
   }
+  if (opt_read_ahead_size)
+    read_ahead.start();
   for (;;)
   {
     char llbuff[21];
-    my_off_t old_off = my_b_tell(file);
+    my_off_t old_off;
     int read_error;
 
-    Log_event* ev = Log_event::read_log_event(file, &read_error,
-                                              glob_description_event,
-                                              opt_verify_binlog_checksum);
+    Log_event* ev= read_ahead.read_event(&old_off, &read_error);
     if (!ev)
     {
       /*
@@ -2998,6 +3238,7 @@ static Exit_status dump_local_log_entries(PRINT_EVENT_INFO *print_event_info,
   retval= ERROR_STOP;
 
 end:
+  read_ahead.end();
   if (fd >= 0)
     my_close(fd, MYF(MY_WME));
   /*
@@ -184,9 +184,11 @@ extern BOOL my_obtain_privilege(LPCSTR lpPrivilege);
 void my_init_atomic_write(void);
 #ifdef __linux__
 my_bool my_test_if_atomic_write(File handle, int pagesize);
+int my_atomic_write_flags(File handle, int pagesize);
 my_bool my_test_if_thinly_provisioned(File handle);
 #else
 # define my_test_if_atomic_write(A, B)      0
+# define my_atomic_write_flags(A, B)        0
 # define my_test_if_thinly_provisioned(A)   0
 #endif /* __linux__ */
 extern my_bool my_may_have_atomic_write;
@@ -429,6 +429,54 @@ static my_bool sfx_could_disable_punch_hole(File file)
   return 0;
 }
 
+/***********************************************************************
+  Untorn writes of Linux 6.11 and later (statx(), RWF_ATOMIC)
+************************************************************************/
+
+#include <sys/stat.h>
+#ifdef STATX_WRITE_ATOMIC
+# include <fcntl.h>
+# include <sys/uio.h>
+# ifndef RWF_ATOMIC
+#  define RWF_ATOMIC 0x00000040 /* <linux/fs.h> */
+# endif
+#endif
+
+/**
+  Check if a file supports atomic writes that are requested with
+  pwritev2(RWF_ATOMIC) or the equivalent asynchronous I/O flag.
+
+  The kernel only guarantees such writes to be untorn if the file is
+  opened with O_DIRECT and if each write covers exactly one naturally
+  aligned block whose size is within the reported atomic write units.
+
+  @return 0       No atomic write support for page_size
+          flags   Flags to submit page_size writes with
+*/
+
+int my_atomic_write_flags(File handle, int page_size)
+{
+#ifdef STATX_WRITE_ATOMIC
+  struct statx st;
+  int fl= fcntl(handle, F_GETFL);
+
+  if (fl == -1 || !(fl & O_DIRECT) || page_size & (page_size - 1))
+    return 0;
+  if (statx(handle, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &st) ||
+      !(st.stx_mask & STATX_WRITE_ATOMIC) ||
+      !(st.stx_attributes & STATX_ATTR_WRITE_ATOMIC))
+    return 0;
+  if (st.stx_atomic_write_unit_min > (unsigned) page_size ||
+      st.stx_atomic_write_unit_max < (unsigned) page_size)
+    return 0;
+  return RWF_ATOMIC;
+#else
+  (void) handle;
+  (void) page_size;
+  return 0;
+#endif
+}
+
 /***********************************************************************
   Generic atomic write code
 ************************************************************************/
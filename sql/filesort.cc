@@ -202,6 +202,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
   IO_CACHE tempfile, buffpek_pointers, *outfile; 
   Sort_param param;
   bool allow_packing_for_sortkeys;
+  bool merging= false;
   Bounded_queue<uchar, uchar> pq;
   SQL_SELECT *const select= filesort->select;
   ha_rows max_rows= filesort->limit;
@@ -350,6 +351,8 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     goto err;
 
   param.sort_form= table;
+  param.sort_threads= (uint) thd->variables.sort_parallel_threads;
+  param.tracker= tracker;
   param.local_sortorder=
     Bounds_checked_array<SORT_FIELD>(filesort->sortorder, s_length);
 
@@ -414,6 +417,8 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     set_if_bigger(param.max_keys_per_buffer, 1);
     maxbuffer--;				// Offset from 0
 
+    tracker->report_merge_start(thd);
+    merging= true;
     if (merge_many_buff(&param, sort->get_raw_buf(),
                         buffpek,&maxbuffer,
 	                      &tempfile))
@@ -438,6 +443,8 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
   error= 0;
 
   err:
+  if (merging)
+    tracker->report_merge_end(thd);
   param.tmp_buffer.free();
   if (!subselect || !subselect->is_uncacheable())
   {
@@ -1065,9 +1072,12 @@ write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
            IO_CACHE *buffpek_pointers, IO_CACHE *tempfile)
 {
   Merge_chunk buffpek;
+  THD *thd= param->sort_form->in_use;
   DBUG_ENTER("write_keys");
 
+  param->tracker->report_sort_start(thd);
   fs_info->sort_buffer(param, count);
+  param->tracker->report_sort_end(thd);
 
   if (!my_b_inited(tempfile) &&
       open_cached_file(tempfile, mysql_tmpdir, TEMP_PREFIX, DISK_BUFFER_SIZE,
@@ -1469,9 +1479,12 @@ static bool save_index(Sort_param *param, uint count,
   uint offset,res_length, length;
   uchar *to;
   DBUG_ENTER("save_index");
+  THD *thd= param->sort_form->in_use;
   DBUG_ASSERT(table_sort->record_pointers == 0);
 
+  param->tracker->report_sort_start(thd);
   table_sort->sort_buffer(param, count);
+  param->tracker->report_sort_end(thd);
 
   if (param->using_addon_fields())
   {
@@ -19,6 +19,9 @@
 #include "sql_const.h"
 #include "sql_sort.h"
 #include "table.h"
+#include "mysqld.h"                             // key_thread_sort
+#include <algorithm>
+#include <atomic>
 
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
@@ -159,6 +162,190 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
+void prefix_sort_str_ptr(uchar **keys, uint count, size_t key_length,
+                         Sort_key_prefix *buffer)
+{
+  const size_t prefix_length= std::min(key_length, sizeof(ulonglong));
+  for (uint i= 0; i < count; i++)
+  {
+    ulonglong prefix= 0;
+    for (size_t j= 0; j < prefix_length; j++)
+      prefix= (prefix << 8) | keys[i][j];
+    /* Keep shorter prefixes aligned to the most significant byte */
+    if (prefix_length < sizeof(ulonglong))
+      prefix<<= 8 * (sizeof(ulonglong) - prefix_length);
+    buffer[i].prefix= prefix;
+    buffer[i].key= keys[i];
+  }
+
+  if (key_length <= sizeof(ulonglong))
+    std::sort(buffer, buffer + count,
+              [](const Sort_key_prefix &a, const Sort_key_prefix &b)
+              { return a.prefix < b.prefix; });
+  else
+  {
+    const size_t suffix_length= key_length - sizeof(ulonglong);
+    std::sort(buffer, buffer + count,
+              [suffix_length](const Sort_key_prefix &a,
+                              const Sort_key_prefix &b)
+              {
+                if (a.prefix != b.prefix)
+                  return a.prefix < b.prefix;
+                return memcmp(a.key + sizeof(ulonglong),
+                              b.key + sizeof(ulonglong), suffix_length) < 0;
+              });
+  }
+
+  for (uint i= 0; i < count; i++)
+    keys[i]= buffer[i].key;
+}
+
+
+/*
+  Do not spawn a sorting thread for fewer keys than this; below it the
+  thread start-up cost outweighs what is saved on comparisons.
+*/
+static const uint MIN_KEYS_PER_SORT_THREAD= 16384;
+
+/*
+  Number of sorting threads that are running on behalf of all filesorts.
+  Concurrent sorts share MAX_SORT_PARALLEL_THREADS threads, so that the
+  number of threads does not grow with the number of connections.
+*/
+static std::atomic<uint> sort_threads_running;
+
+/**
+  Reserve threads for sort_keys_parallel().
+  @param wanted  number of threads to start
+  @return number of threads that may be started, at most wanted
+*/
+static uint sort_threads_reserve(uint wanted)
+{
+  uint running= sort_threads_running.load(std::memory_order_relaxed);
+  uint n;
+  DBUG_EXECUTE_IF("sort_threads_unavailable", return 0;);
+  do
+  {
+    if (running >= MAX_SORT_PARALLEL_THREADS)
+      return 0;
+    n= std::min(wanted, MAX_SORT_PARALLEL_THREADS - running);
+  }
+  while (!sort_threads_running.compare_exchange_weak(running, running + n,
+                                                    std::memory_order_relaxed));
+  return n;
+}
+
+/** The chunks of a sort_keys_parallel() */
+struct Sort_parallel_parts
+{
+  uchar **keys;
+  /** chunk i is keys[bounds[i]] .. keys[bounds[i+1]-1] */
+  uint bounds[MAX_SORT_PARALLEL_THREADS + 1];
+  uint n_parts;
+  /** the next chunk that is not being sorted yet */
+  std::atomic<uint> next_part;
+  qsort_cmp2 cmp;
+  void *cmp_arg;
+  Sort_key_prefix *prefixes;
+  size_t key_length;
+
+  /** Sort chunks until all of them have been picked by some thread */
+  void sort_parts()
+  {
+    for (uint i; (i= next_part.fetch_add(1, std::memory_order_relaxed)) <
+                 n_parts; )
+    {
+      if (prefixes)
+        prefix_sort_str_ptr(keys + bounds[i], bounds[i + 1] - bounds[i],
+                            key_length, prefixes + bounds[i]);
+      else
+        my_qsort2(keys + bounds[i], bounds[i + 1] - bounds[i],
+                  sizeof(uchar*), cmp, cmp_arg);
+    }
+  }
+};
+
+
+pthread_handler_t sort_thread_handler(void *arg)
+{
+  my_thread_init();
+  static_cast<Sort_parallel_parts*>(arg)->sort_parts();
+  my_thread_end();
+  return NULL;
+}
+
+
+/**
+  Sort an array of key pointers by splitting it into n_parts chunks that
+  are sorted concurrently, and merging the sorted chunks pairwise.
+
+  The chunks only depend on count and n_parts, and the merge takes equal
+  keys from the earlier chunk first. So the order of equal keys does not
+  depend on how many sorting threads could be started. Chunks that no
+  sorting thread picks up are sorted by the calling thread.
+
+  @param keys      the key pointers to sort
+  @param count     number of keys
+  @param n_parts   number of chunks, at least 2
+  @param cmp       key comparison function
+  @param cmp_arg   first argument to cmp
+  @param buffer    scratch space for count key pointers
+  @param prefixes  scratch space for count Sort_key_prefix elements
+                   for sorting the chunks with prefix_sort_str_ptr(),
+                   or NULL to sort them with my_qsort2()
+  @param key_length  number of bytes compared in each key, with prefixes
+*/
+static void sort_keys_parallel(uchar **keys, uint count, uint n_parts,
+                               qsort_cmp2 cmp, void *cmp_arg, uchar **buffer,
+                               Sort_key_prefix *prefixes, size_t key_length)
+{
+  Sort_parallel_parts parts;
+  parts.keys= keys;
+  parts.n_parts= n_parts;
+  parts.next_part= 0;
+  parts.cmp= cmp;
+  parts.cmp_arg= cmp_arg;
+  parts.prefixes= prefixes;
+  parts.key_length= key_length;
+  for (uint i= 0; i <= n_parts; i++)
+    parts.bounds[i]= (uint) ((ulonglong) count * i / n_parts);
+
+  const uint n_reserved= sort_threads_reserve(n_parts - 1);
+  pthread_t threads[MAX_SORT_PARALLEL_THREADS];
+  uint n_started= 0;
+  for (; n_started < n_reserved; n_started++)
+    if (mysql_thread_create(key_thread_sort, &threads[n_started], NULL,
+                            sort_thread_handler, &parts))
+      break;
+  parts.sort_parts();
+  for (uint i= 0; i < n_started; i++)
+    pthread_join(threads[i], NULL);
+  sort_threads_running.fetch_sub(n_reserved, std::memory_order_relaxed);
+
+  auto less= [cmp, cmp_arg](const uchar *a, const uchar *b)
+  {
+    return cmp(cmp_arg, &a, &b) < 0;
+  };
+
+  /* Merge adjacent sorted runs, doubling the run width on each pass. */
+  const uint *bounds= parts.bounds;
+  uchar **from= keys, **to= buffer;
+  for (uint width= 1; width < n_parts; width*= 2)
+  {
+    for (uint i= 0; i < n_parts; i+= 2 * width)
+    {
+      uint lo= bounds[i];
+      uint mid= bounds[std::min(i + width, n_parts)];
+      uint hi= bounds[std::min(i + 2 * width, n_parts)];
+      std::merge(from + lo, from + mid, from + mid, from + hi, to + lo, less);
+    }
+    std::swap(from, to);
+  }
+  if (from != keys)
+    memcpy(keys, from, count * sizeof(uchar*));
+}
+
+
 void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
@@ -182,6 +369,41 @@ void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
     return;
   }
 
+  /*
+    Keys that are not packed are compared with memcmp(), see
+    get_ptr_compare(), so they can be sorted by their prefixes.
+    Without addon fields, the key ends in the row reference, so no two
+    keys are equal and any sorting algorithm produces the same order as
+    my_qsort2(). Keys with addon fields may be equal, and their order
+    in the result must not change.
+  */
+  Sort_key_prefix *prefixes= NULL;
+  if (!param->using_packed_sortkeys() && !param->using_addon_fields())
+    prefixes= (Sort_key_prefix*)
+      my_malloc(PSI_INSTRUMENT_ME, count * sizeof(Sort_key_prefix),
+                MYF(MY_THREAD_SPECIFIC));
+
+  uint n_parts= std::min(param->sort_threads, count / MIN_KEYS_PER_SORT_THREAD);
+  if (n_parts > 1 &&
+      (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
+                                   MYF(MY_THREAD_SPECIFIC))))
+  {
+    sort_keys_parallel(m_sort_keys, count, n_parts,
+                       param->get_compare_function(),
+                       param->get_compare_argument(&size),
+                       buffer, prefixes, param->sort_length);
+    my_free(buffer);
+    my_free(prefixes);
+    return;
+  }
+
+  if (prefixes)
+  {
+    prefix_sort_str_ptr(m_sort_keys, count, param->sort_length, prefixes);
+    my_free(prefixes);
+    return;
+  }
+
   my_qsort2(m_sort_keys, count, sizeof(uchar*),
             param->get_compare_function(),
             param->get_compare_argument(&size));
@@ -7186,6 +7186,10 @@ int handler::binlog_log_row(TABLE *table,
 
   error= (*log_func)(thd, table, row_logging_has_trans,
                      before_record, after_record);
+  if (!error &&
+      opt_binlog_dependency_tracking == BINLOG_DEPENDENCY_TRACKING_WRITESET)
+    binlog_writeset_add_row(thd, table, row_logging_has_trans,
+                            before_record, after_record);
   DBUG_RETURN(error ? HA_ERR_RBR_LOGGING_FAILED : 0);
 }
 
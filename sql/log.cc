@@ -113,6 +113,7 @@ ulong opt_binlog_dbug_fsync_sleep= 0;
 
 mysql_mutex_t LOCK_prepare_ordered;
 mysql_cond_t COND_prepare_ordered;
+mysql_mutex_t LOCK_binlog_sync;
 mysql_mutex_t LOCK_after_binlog_sync;
 mysql_mutex_t LOCK_commit_ordered;
 
@@ -121,8 +122,18 @@ static ulonglong binlog_status_var_num_group_commits;
 static ulonglong binlog_status_group_commit_trigger_count;
 static ulonglong binlog_status_group_commit_trigger_lock_wait;
 static ulonglong binlog_status_group_commit_trigger_timeout;
+static ulonglong binlog_status_stage_queue[BINLOG_STAGE_COUNT];
+static ulonglong binlog_status_stage_wait_time[BINLOG_STAGE_COUNT];
 static char binlog_snapshot_file[FN_REFLEN];
 static ulonglong binlog_snapshot_position;
+static ulonglong binlog_status_compression_bytes_in;
+static ulonglong binlog_status_compression_bytes_out;
+static ulonglong binlog_status_compression_time;
+
+/* Totals over all events compressed with log_bin_compress */
+static Atomic_counter<ulonglong> binlog_compression_bytes_in;
+static Atomic_counter<ulonglong> binlog_compression_bytes_out;
+static Atomic_counter<ulonglong> binlog_compression_time;
 
 static const char *fatal_log_error=
   "Could not use %s for logging (error %d). "
@@ -135,6 +146,22 @@ static SHOW_VAR binlog_status_vars_detail[]=
 {
   {"commits",
     (char *)&binlog_status_var_num_commits, SHOW_LONGLONG},
+  {"compression_bytes_in",
+    (char *)&binlog_status_compression_bytes_in, SHOW_LONGLONG},
+  {"compression_bytes_out",
+    (char *)&binlog_status_compression_bytes_out, SHOW_LONGLONG},
+  {"compression_time",
+    (char *)&binlog_status_compression_time, SHOW_LONGLONG},
+  {"commit_stage_queue",
+    (char *)&binlog_status_stage_queue[BINLOG_STAGE_COMMIT], SHOW_LONGLONG},
+  {"commit_stage_wait_time",
+    (char *)&binlog_status_stage_wait_time[BINLOG_STAGE_COMMIT],
+    SHOW_LONGLONG},
+  {"flush_stage_queue",
+    (char *)&binlog_status_stage_queue[BINLOG_STAGE_FLUSH], SHOW_LONGLONG},
+  {"flush_stage_wait_time",
+    (char *)&binlog_status_stage_wait_time[BINLOG_STAGE_FLUSH],
+    SHOW_LONGLONG},
   {"group_commits",
     (char *)&binlog_status_var_num_group_commits, SHOW_LONGLONG},
   {"group_commit_trigger_count",
@@ -147,6 +174,11 @@ static SHOW_VAR binlog_status_vars_detail[]=
     (char *)&binlog_snapshot_file, SHOW_CHAR},
   {"snapshot_position",
    (char *)&binlog_snapshot_position, SHOW_LONGLONG},
+  {"sync_stage_queue",
+    (char *)&binlog_status_stage_queue[BINLOG_STAGE_SYNC], SHOW_LONGLONG},
+  {"sync_stage_wait_time",
+    (char *)&binlog_status_stage_wait_time[BINLOG_STAGE_SYNC],
+    SHOW_LONGLONG},
   {NullS, NullS, SHOW_LONG}
 };
 
@@ -515,7 +547,8 @@ class binlog_cache_mngr {
                     ulong *param_ptr_binlog_stmt_cache_disk_use,
                     ulong *param_ptr_binlog_cache_use,
                     ulong *param_ptr_binlog_cache_disk_use)
-    : last_commit_pos_offset(0), using_xa(FALSE), xa_xid(0)
+    : last_commit_pos_offset(0), using_xa(FALSE), xa_xid(0),
+      writeset(key_memory_binlog_cache_mngr), writeset_unknown(false)
   {
      stmt_cache.set_binlog_cache_info(param_max_binlog_stmt_cache_size,
                                       param_ptr_binlog_stmt_cache_use,
@@ -536,6 +569,8 @@ class binlog_cache_mngr {
       using_xa= FALSE;
       last_commit_pos_file[0]= 0;
       last_commit_pos_offset= 0;
+      writeset.clear();
+      writeset_unknown= false;
     }
   }
 
@@ -578,6 +613,18 @@ class binlog_cache_mngr {
   /* Set if we get an error during commit that must be returned from unlog(). */
   bool delayed_error;
 
+  /*
+    Hashes of the unique keys of the rows that the transaction modified,
+    collected by binlog_writeset_add_row() when
+    binlog_transaction_dependency_tracking=WRITESET.
+  */
+  Dynamic_array<uint32> writeset;
+  /*
+    Set if the writeset does not cover all changes of the transaction,
+    for example because something was logged in statement format.
+  */
+  bool writeset_unknown;
+
 private:
 
   binlog_cache_mngr& operator=(const binlog_cache_mngr& info);
@@ -2410,6 +2457,174 @@ void binlog_reset_cache(THD *thd)
 }
 
 
+/**
+  Compute the writeset hash of a unique key of a row.
+
+  @param table   the table
+  @param keynr   the unique key
+  @param diff    offset of the row from table->record[0]
+  @param hash    [out] the hash
+
+  @retval false  if the key cannot be hashed, because it is a prefix or
+                 long unique key, or because some key column is not
+                 present in the row image
+*/
+static bool binlog_writeset_hash_key(TABLE *table, uint keynr,
+                                     my_ptrdiff_t diff, uint32 *hash)
+{
+  const KEY *key= &table->key_info[keynr];
+  if (key->algorithm == HA_KEY_ALG_LONG_HASH)
+    return false;
+
+  Hasher hasher;
+  hasher.add(&my_charset_bin, table->s->db.str, table->s->db.length);
+  hasher.add(&my_charset_bin, table->s->table_name.str,
+             table->s->table_name.length);
+  hasher.add(&my_charset_bin, (const uchar*) &keynr, sizeof keynr);
+
+  const KEY_PART_INFO *key_part= key->key_part;
+  const KEY_PART_INFO *end= key_part + key->user_defined_key_parts;
+  for (; key_part != end; key_part++)
+  {
+    Field *field= key_part->field;
+    if (key_part->key_part_flag & HA_PART_KEY_SEG ||
+        (!bitmap_is_set(table->read_set, field->field_index) &&
+         !bitmap_is_set(table->write_set, field->field_index)))
+      return false;
+    field->move_field_offset(diff);
+    field->hash(&hasher);
+    field->move_field_offset(-diff);
+  }
+  *hash= hasher.finalize();
+  return true;
+}
+
+
+/**
+  Add the unique keys of a row that was logged in row format to the
+  writeset of the transaction.
+
+  The writeset is used by binlog_transaction_dependency_tracking=WRITESET
+  to find out which transactions can be applied in parallel on a slave.
+  Rows of tables without a primary key or of tables that are referenced by
+  foreign keys make the writeset unknown, because the conflicts of such
+  changes cannot be determined from the unique keys alone. So does a
+  unique key that cannot be hashed, and a writeset that grows beyond
+  binlog_transaction_dependency_history_size, which could never be added
+  to the history anyway.
+*/
+void binlog_writeset_add_row(THD *thd, TABLE *table, bool is_trans,
+                             const uchar *before_record,
+                             const uchar *after_record)
+{
+  binlog_cache_mngr *const cache_mngr=
+    (binlog_cache_mngr*) thd_get_ha_data(thd, binlog_hton);
+  if (!cache_mngr || cache_mngr->writeset_unknown)
+    return;
+
+  TABLE_SHARE *share= table->s;
+  if (!is_trans || share->primary_key == MAX_KEY ||
+      table->file->referenced_by_foreign_key())
+  {
+    cache_mngr->writeset_unknown= true;
+    return;
+  }
+
+  for (const uchar *record : {before_record, after_record})
+  {
+    if (!record)
+      continue;
+    const my_ptrdiff_t diff= record - table->record[0];
+    for (uint keynr= 0; keynr < share->keys; keynr++)
+    {
+      if (!(table->key_info[keynr].flags & HA_NOSAME))
+        continue;
+      uint32 hash;
+      if (cache_mngr->writeset.elements() >=
+          opt_binlog_dependency_history_size ||
+          !binlog_writeset_hash_key(table, keynr, diff, &hash))
+      {
+        cache_mngr->writeset_unknown= true;
+        cache_mngr->writeset.clear();
+        return;
+      }
+      cache_mngr->writeset.append(hash);
+    }
+  }
+}
+
+
+bool Binlog_writeset_history::contains(uint32 hash) const
+{
+  for (size_t i= (hash * 0x9E3779B1U) & (m_size - 1);;
+       i= (i + 1) & (m_size - 1))
+  {
+    const uint64 slot= m_slots[i];
+    if (uint32(slot >> 32) != m_generation)
+      return false;
+    if (uint32(slot) == hash)
+      return true;
+  }
+}
+
+
+bool Binlog_writeset_history::start(size_t max_size)
+{
+  commit_id= 0;
+  m_count= 0;
+  size_t size= 16;
+  while (size < 2 * max_size)
+    size<<= 1;
+  if (size != m_size)
+  {
+    my_free(m_slots);
+    m_slots= (uint64*) my_malloc(key_memory_binlog_cache_mngr,
+                                 size * sizeof *m_slots,
+                                 MYF(MY_ZEROFILL));
+    m_size= m_slots ? size : 0;
+    m_generation= 0;
+  }
+  if (!m_slots)
+    return false;
+  m_max= max_size;
+  if (!++m_generation)
+  {
+    /* Wrap-around: an old slot could look like a current one. */
+    bzero(m_slots, m_size * sizeof *m_slots);
+    m_generation= 1;
+  }
+  return true;
+}
+
+
+bool Binlog_writeset_history::add(const uint32 *hashes, size_t n)
+{
+  if (!m_slots || m_count + n > m_max)
+    return false;
+  for (size_t i= 0; i < n; i++)
+    if (contains(hashes[i]))
+      return false;
+  for (size_t j= 0; j < n; j++)
+  {
+    const uint32 hash= hashes[j];
+    for (size_t i= (hash * 0x9E3779B1U) & (m_size - 1);;
+         i= (i + 1) & (m_size - 1))
+    {
+      const uint64 slot= m_slots[i];
+      if (uint32(slot >> 32) != m_generation)
+      {
+        m_slots[i]= uint64{m_generation} << 32 | hash;
+        m_count++;
+        break;
+      }
+      if (uint32(slot) == hash)
+        break; /* the transaction modified the same key twice */
+    }
+  }
+  return true;
+}
+
+
 void MYSQL_BIN_LOG::set_write_error(THD *thd, bool is_transactional)
 {
   DBUG_ENTER("MYSQL_BIN_LOG::set_write_error");
@@ -3537,6 +3752,7 @@ MYSQL_BIN_LOG::MYSQL_BIN_LOG(uint *sync_period)
    group_commit_trigger_lock_wait(0),
    sync_period_ptr(sync_period), sync_counter(0),
    state_file_deleted(false), binlog_state_recover_done(false),
+   gtid_index_file(-1), gtid_index_span(0), gtid_index_next_pos(0),
    is_relay_log(0), relay_signal_cnt(0),
    checksum_alg_reset(BINLOG_CHECKSUM_ALG_UNDEF),
    relay_log_checksum_alg(BINLOG_CHECKSUM_ALG_UNDEF),
@@ -3552,6 +3768,11 @@ MYSQL_BIN_LOG::MYSQL_BIN_LOG(uint *sync_period)
   index_file_name[0] = 0;
   bzero((char*) &index_file, sizeof(index_file));
   bzero((char*) &purge_index_file, sizeof(purge_index_file));
+  for (uint i= 0; i < BINLOG_STAGE_COUNT; i++)
+  {
+    stage_queue[i]= 0;
+    stage_wait_time[i]= 0;
+  }
 }
 
 void MYSQL_BIN_LOG::stop_background_thread()
@@ -4115,6 +4336,9 @@ bool MYSQL_BIN_LOG::open(const char *log_name,
     }
   }
 
+  if (!is_relay_log)
+    open_gtid_index();
+
   log_state= LOG_OPENED;
 
 #ifdef HAVE_REPLICATION
@@ -4383,6 +4607,17 @@ int MYSQL_BIN_LOG::find_next_log(LOG_INFO* linfo, bool need_lock)
 }
 
 
+/*
+  Delete the GTID index of a binlog file that is being deleted, if any.
+*/
+static void delete_gtid_index(const char *log_name)
+{
+  char buf[FN_REFLEN];
+  binlog_gtid_index_name(buf, log_name);
+  my_delete(buf, MYF(0));
+}
+
+
 /**
   Delete all logs referred to in the index file.
 
@@ -4453,8 +4688,8 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool create_new_log,
       transactions in engines. So force a commit checkpoint first.
 
       Note that we take and immediately
-      release LOCK_after_binlog_sync/LOCK_commit_ordered. This has
-      the effect to ensure that any on-going group commit (in
+      release LOCK_binlog_sync/LOCK_after_binlog_sync/LOCK_commit_ordered.
+      This has the effect to ensure that any on-going group commit (in
       trx_group_commit_leader()) has completed before we request the checkpoint,
       due to the chaining of LOCK_log and LOCK_commit_ordered in that function.
       (We are holding LOCK_log, so no new group commit can start).
@@ -4465,6 +4700,7 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool create_new_log,
       later would leave such transaction not recoverable.
     */
 
+    wait_for_sync_stage();
     mysql_mutex_lock(&LOCK_after_binlog_sync);
     mysql_mutex_lock(&LOCK_commit_ordered);
     mysql_mutex_unlock(&LOCK_after_binlog_sync);
@@ -4521,6 +4757,8 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool create_new_log,
 
   for (;;)
   {
+    if (!is_relay_log)
+      delete_gtid_index(linfo.log_file_name);
     if (unlikely((error= my_delete(linfo.log_file_name, MYF(0)))))
     {
       if (my_errno == ENOENT) 
@@ -5137,6 +5375,8 @@ int MYSQL_BIN_LOG::purge_index_entry(THD *thd, ulonglong *reclaimed_space,
         error= 0;
 
         DBUG_PRINT("info",("purging %s",log_info.log_file_name));
+        if (!is_relay_log)
+          delete_gtid_index(log_info.log_file_name);
         if (!my_delete(log_info.log_file_name, MYF(0)))
         {
           if (reclaimed_space)
@@ -5443,6 +5683,9 @@ int MYSQL_BIN_LOG::new_file_impl()
     DBUG_RETURN(error);
   }
 
+  /* The file must not be switched under a group commit that syncs it */
+  wait_for_sync_stage();
+
   mysql_mutex_lock(&LOCK_index);
 
   /* Reuse old name if not binlog and not update log */
@@ -5702,25 +5945,36 @@ bool MYSQL_BIN_LOG::write_event_buffer(uchar* buf, uint len)
   DBUG_RETURN(error);
 }
 
+bool MYSQL_BIN_LOG::sync_log_file(File fd)
+{
+  bool err= mysql_file_sync(fd, MYF(MY_WME));
+#ifndef DBUG_OFF
+  if (opt_binlog_dbug_fsync_sleep > 0)
+    my_sleep(opt_binlog_dbug_fsync_sleep);
+#endif
+  return err;
+}
+
 bool MYSQL_BIN_LOG::flush_and_sync(bool *synced)
 {
   int err=0, fd=log_file.file;
   if (synced)
     *synced= 0;
   mysql_mutex_assert_owner(&LOCK_log);
+  /*
+    Let a group commit in the sync stage update binlog_end_pos first, so
+    that it does not move backwards.
+  */
+  wait_for_sync_stage();
   if (flush_io_cache(&log_file))
     return 1;
   uint sync_period= get_sync_period();
   if (sync_period && ++sync_counter >= sync_period)
   {
     sync_counter= 0;
-    err= mysql_file_sync(fd, MYF(MY_WME));
+    err= sync_log_file(fd);
     if (synced)
       *synced= 1;
-#ifndef DBUG_OFF
-    if (opt_binlog_dbug_fsync_sleep > 0)
-      my_sleep(opt_binlog_dbug_fsync_sleep);
-#endif
   }
   return err;
 }
@@ -6435,6 +6689,10 @@ MYSQL_BIN_LOG::write_gtid_event(THD *thd, bool standalone,
     producing a duplicate GTID.
   */
   thd->variables.gtid_seq_no= 0;
+
+  /* The index entry must have the binlog state from before this GTID. */
+  write_gtid_index_entry();
+
   if (seq_no != 0)
   {
     /* Use the specified sequence number. */
@@ -6480,6 +6738,137 @@ MYSQL_BIN_LOG::write_gtid_event(THD *thd, bool standalone,
 }
 
 
+/*
+  GTID index of a binlog file.
+
+  When binlog_gtid_index_span is non-zero, a text file <binlog name>.gidx is
+  written next to each binlog file. Whenever a GTID event is written at
+  least binlog_gtid_index_span bytes after the previous entry, the line
+
+    G <offset of the GTID event> <binlog state before the event>
+
+  is appended. The state is listed in the order of the Gtid_list event, that
+  is grouped by domain, with the last GTID logged in each domain last. When
+  the binlog file is closed, the line
+
+    E <size of the binlog file>
+
+  marks the index as complete. A dump thread connecting with a GTID position
+  uses the index to skip the part of the file that the slave already has,
+  see gtid_index_find_start() in sql_repl.cc. An index that is not complete
+  (eg. after a crash) is rebuilt by the first dump thread that needs it.
+*/
+void binlog_gtid_index_name(char *to, const char *log_name)
+{
+  strxnmov(to, FN_REFLEN-1, log_name, ".gidx", NullS);
+}
+
+
+void MYSQL_BIN_LOG::open_gtid_index()
+{
+  char buf[FN_REFLEN];
+
+  mysql_mutex_assert_owner(&LOCK_log);
+  DBUG_ASSERT(gtid_index_file < 0);
+  gtid_index_next_pos= 0;
+  if (!(gtid_index_span= opt_binlog_gtid_index_span))
+    return;
+
+  binlog_gtid_index_name(buf, log_file_name);
+  if ((gtid_index_file= mysql_file_open(key_file_binlog_gtid_index, buf,
+                                        O_WRONLY|O_CREAT|O_TRUNC|O_BINARY,
+                                        MYF(MY_WME))) < 0)
+  {
+    /* The index is only an optimisation, the binlog works without it. */
+    sql_print_warning("Could not create GTID index file '%s', errno: %d",
+                      buf, my_errno);
+    gtid_index_span= 0;
+  }
+}
+
+
+/*
+  Append the index line for a GTID event at OFFSET with binlog state STATE
+  before the event. Returns true on error.
+*/
+bool binlog_gtid_index_entry(String *to, my_off_t offset,
+                             rpl_binlog_state *state)
+{
+  rpl_gtid *list;
+  uint32 count= state->count();
+  bool first= true;
+  bool res= true;
+  char buf[22];
+
+  if (!(list= (rpl_gtid *) my_malloc(PSI_INSTRUMENT_ME,
+                                     (count ? count : 1) * sizeof(*list),
+                                     MYF(MY_WME))))
+    return true;
+  if (state->get_gtid_list(list, count) ||
+      to->append(STRING_WITH_LEN("G ")) ||
+      to->append(buf, (uint) (longlong10_to_str(offset, buf, 10) - buf)) ||
+      to->append(' '))
+    goto end;
+  for (uint32 i= 0; i < count; i++)
+    if (rpl_slave_state_tostring_helper(to, &list[i], &first))
+      goto end;
+  res= to->append('\n');
+
+end:
+  my_free(list);
+  return res;
+}
+
+
+/*
+  Add an entry for the GTID event about to be written at the current
+  position, if the previous entry is far enough behind.
+*/
+void MYSQL_BIN_LOG::write_gtid_index_entry()
+{
+  my_off_t offset;
+  StringBuffer<256> entry;
+
+  mysql_mutex_assert_owner(&LOCK_log);
+  if (gtid_index_file < 0 ||
+      (offset= my_b_tell(&log_file)) < gtid_index_next_pos ||
+      binlog_gtid_index_entry(&entry, offset, &rpl_global_gtid_binlog_state))
+    return;
+
+  if (mysql_file_write(gtid_index_file, (uchar *) entry.ptr(), entry.length(),
+                       MYF(MY_WME|MY_NABP)))
+  {
+    /*
+      Stop writing the index. It is left without the final line, so it is
+      used only while this is the active binlog file, and rebuilt later.
+    */
+    mysql_file_close(gtid_index_file, MYF(0));
+    gtid_index_file= -1;
+  }
+  else
+    gtid_index_next_pos= offset + gtid_index_span;
+}
+
+
+/*
+  Write the final line of the GTID index when the binlog file is closed.
+*/
+void MYSQL_BIN_LOG::close_gtid_index()
+{
+  char buf[FN_REFLEN];
+  size_t len;
+
+  mysql_mutex_assert_owner(&LOCK_log);
+  if (gtid_index_file < 0)
+    return;
+  len= my_snprintf(buf, sizeof(buf), "E %llu\n",
+                   (ulonglong) my_b_tell(&log_file));
+  mysql_file_write(gtid_index_file, (uchar *) buf, len, MYF(MY_WME|MY_NABP));
+  mysql_file_close(gtid_index_file, MYF(MY_WME));
+  gtid_index_file= -1;
+}
+
+
 int
 MYSQL_BIN_LOG::write_state_to_file()
 {
@@ -6816,6 +7205,8 @@ bool MYSQL_BIN_LOG::write(Log_event *event_info, my_bool *with_annotate)
       is_trans_cache= use_trans_cache(thd, using_trans);
       cache_data= cache_mngr->get_binlog_cache_data(is_trans_cache);
       file= &cache_data->cache_log;
+      /* Only row events can be covered by the writeset. */
+      cache_mngr->writeset_unknown= true;
 
       if (thd->lex->stmt_accessed_non_trans_temp_table() && is_trans_cache)
         thd->transaction->stmt.mark_modified_non_trans_temp_table();
@@ -7387,6 +7778,7 @@ int MYSQL_BIN_LOG::rotate_and_purge(bool force_rotate,
           checkpoint notification request until early binlogged
           concurrent commits have has been completed.
   */
+  wait_for_sync_stage();
   mysql_mutex_lock(&LOCK_after_binlog_sync);
   mysql_mutex_unlock(&LOCK_log);
   mysql_mutex_lock(&LOCK_commit_ordered);
@@ -7679,6 +8071,11 @@ bool MYSQL_BIN_LOG::write_incident(THD *thd)
   mysql_mutex_lock(&LOCK_log);
   if (likely(is_open()))
   {
+    /*
+      Let a group commit in the sync stage update binlog_end_pos first,
+      also when the incident event cannot be written or flushed.
+    */
+    wait_for_sync_stage();
     prev_binlog_id= current_binlog_id;
     if (likely(
             !(error= DBUG_EVALUATE_IF("incident_event_write_error", 1,
@@ -7736,6 +8133,7 @@ write_binlog_checkpoint_event_already_locked(const char *name_arg, uint len)
 {
   my_off_t offset;
   Binlog_checkpoint_log_event ev(name_arg, len);
+  wait_for_sync_stage();
   /*
     Note that we must sync the binlog checkpoint to disk.
     Otherwise a subsequent log purge could delete binlogs that XA recovery
@@ -8358,6 +8756,20 @@ MYSQL_BIN_LOG::write_transaction_to_binlog_events(group_commit_entry *entry)
   return 1;
 }
 
+/*
+  Wait to enter a stage of binlog group commit, and account for the wait in
+  the Binlog_*_stage_queue and Binlog_*_stage_wait_time status variables.
+*/
+void MYSQL_BIN_LOG::enter_commit_stage(enum_binlog_commit_stage stage,
+                                       mysql_mutex_t *lock)
+{
+  stage_queue[stage]++;
+  ulonglong start= microsecond_interval_timer();
+  mysql_mutex_lock(lock);
+  stage_wait_time[stage]+= microsecond_interval_timer() - start;
+  stage_queue[stage]--;
+}
+
 /*
   Do binlog group commit as the lead thread.
 
@@ -8367,6 +8779,12 @@ MYSQL_BIN_LOG::write_transaction_to_binlog_events(group_commit_entry *entry)
   for LOCK_log). After commit is done, all other threads in the queue will be
   signalled.
 
+  The group commit runs in three stages, each with its own mutex taken
+  hand-over-hand: the flush stage (LOCK_log) writes the group to the binlog,
+  the sync stage (LOCK_binlog_sync) makes it durable and visible to the dump
+  threads, and the commit stage (LOCK_commit_ordered) commits it in the
+  engines. When the group has to fsync the binlog, LOCK_log is released
+  before the fsync, so that the next group can write while this one syncs.
  */
 void
 MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
@@ -8376,6 +8794,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
   group_commit_entry *current, *last_in_queue;
   group_commit_entry *queue= NULL;
   bool check_purge= false;
+  bool log_locked= true, sync_locked= false;
   ulong UNINIT_VAR(binlog_id);
   uint64 commit_id;
   DBUG_ENTER("MYSQL_BIN_LOG::trx_group_commit_leader");
@@ -8392,7 +8811,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
       that queued up while we were waiting.
     */
     DEBUG_SYNC(leader->thd, "commit_before_get_LOCK_log");
-    mysql_mutex_lock(&LOCK_log);
+    enter_commit_stage(BINLOG_STAGE_FLUSH, &LOCK_log);
     DEBUG_SYNC(leader->thd, "commit_after_get_LOCK_log");
 
     mysql_mutex_lock(&LOCK_prepare_ordered);
@@ -8463,8 +8882,12 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
                   !cache_mngr->trx_cache.empty()  ||
                   current->thd->transaction->xid_state.is_explicit_XA());
 
+      uint64 trx_commit_id= commit_id;
+      if (opt_binlog_dependency_tracking ==
+          BINLOG_DEPENDENCY_TRACKING_WRITESET)
+        trx_commit_id= writeset_commit_id(current, commit_id);
       if (unlikely((current->error= write_transaction_or_stmt(current,
-                                                              commit_id))))
+                                                              trx_commit_id))))
         current->commit_errno= errno;
 
       strmake_buf(cache_mngr->last_commit_pos_file, log_file_name);
@@ -8492,8 +8915,44 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     }
     set_current_thd(leader->thd);
 
-    bool synced= 0;
-    if (unlikely(flush_and_sync(&synced)))
+    /*
+      Flush the group to the binlog file, then move on to the sync stage.
+      All groups pass through the sync stage, even without an fsync, so that
+      binlog_end_pos is updated in binlog order.
+
+      If this group needs to fsync, release LOCK_log before the fsync so that
+      the next group can write to the binlog meanwhile. Anything that closes
+      or switches the binlog file under LOCK_log waits for the sync stage
+      first (wait_for_sync_stage()). We keep LOCK_log when the binlog is to be
+      rotated, as rotate() must run after this group is durable, and leave
+      the sync stage before rotate().
+    */
+    File fd= log_file.file;
+    bool need_sync= false;
+    bool err= flush_io_cache(&log_file);
+    if (!err)
+    {
+      uint sync_period= get_sync_period();
+      if (sync_period && ++sync_counter >= sync_period)
+      {
+        sync_counter= 0;
+        need_sync= true;
+      }
+    }
+
+    DEBUG_SYNC(leader->thd, "commit_before_get_LOCK_binlog_sync");
+    enter_commit_stage(BINLOG_STAGE_SYNC, &LOCK_binlog_sync);
+    sync_locked= true;
+    if (need_sync && my_b_tell(&log_file) < (my_off_t) max_size)
+    {
+      mysql_mutex_unlock(&LOCK_log);
+      log_locked= false;
+      DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_log_before_sync");
+    }
+    if (need_sync)
+      err= sync_log_file(fd);
+
+    if (unlikely(err))
     {
       for (current= queue; current != NULL; current= current->next)
       {
@@ -8511,7 +8970,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
       bool any_error= false;
 
       mysql_mutex_assert_not_owner(&LOCK_prepare_ordered);
-      mysql_mutex_assert_owner(&LOCK_log);
+      mysql_mutex_assert_owner(&LOCK_binlog_sync);
       mysql_mutex_assert_not_owner(&LOCK_after_binlog_sync);
       mysql_mutex_assert_not_owner(&LOCK_commit_ordered);
 
@@ -8567,7 +9026,18 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
       mark_xids_active(binlog_id, xid_count);
     }
 
-    if (rotate(false, &check_purge))
+    /*
+      rotate() waits for the sync stage (wait_for_sync_stage()), so we must
+      leave it first. As we still hold LOCK_log, no other group can enter
+      the sync stage before LOCK_after_binlog_sync is taken below.
+    */
+    if (log_locked)
+    {
+      mysql_mutex_unlock(&LOCK_binlog_sync);
+      sync_locked= false;
+    }
+
+    if (log_locked && rotate(false, &check_purge))
     {
       /*
         If we fail to rotate, which thread should get the error?
@@ -8587,18 +9057,23 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
       check_purge= false;
     }
     /* In case of binlog rotate, update the correct current binlog offset. */
-    commit_offset= my_b_write_tell(&log_file);
+    if (log_locked)
+      commit_offset= my_b_write_tell(&log_file);
   }
 
   DEBUG_SYNC(leader->thd, "commit_before_get_LOCK_after_binlog_sync");
   mysql_mutex_lock(&LOCK_after_binlog_sync);
   /*
-    We cannot unlock LOCK_log until we have locked LOCK_after_binlog_sync;
-    otherwise scheduling could allow the next group commit to run ahead of us,
-    messing up the order of commit_ordered() calls. But as soon as
-    LOCK_after_binlog_sync is obtained, we can let the next group commit start.
+    We cannot unlock LOCK_log or LOCK_binlog_sync until we have locked
+    LOCK_after_binlog_sync; otherwise scheduling could allow the next group
+    commit to run ahead of us, messing up the order of commit_ordered() calls.
+    But as soon as LOCK_after_binlog_sync is obtained, we can let the next
+    group commit start.
   */
-  mysql_mutex_unlock(&LOCK_log);
+  if (log_locked)
+    mysql_mutex_unlock(&LOCK_log);
+  if (sync_locked)
+    mysql_mutex_unlock(&LOCK_binlog_sync);
 
   DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_log");
 
@@ -8630,7 +9105,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
 
   DEBUG_SYNC(leader->thd, "commit_before_get_LOCK_commit_ordered");
 
-  mysql_mutex_lock(&LOCK_commit_ordered);
+  enter_commit_stage(BINLOG_STAGE_COMMIT, &LOCK_commit_ordered);
   DBUG_EXECUTE_IF("crash_before_engine_commit",
       {
         DBUG_SUICIDE();
@@ -8716,6 +9191,67 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
 }
 
 
+/*
+  Choose the commit_id of a transaction for
+  binlog_transaction_dependency_tracking=WRITESET.
+
+  A transaction whose writeset is known and does not intersect with the
+  writesets of the previous transactions that have the same commit_id
+  inherits that commit_id, so that a slave will run it in parallel with
+  them. Otherwise the transaction starts a new commit_id group, using the
+  commit_id of its own group commit. Transactions of one group commit can
+  always be applied in parallel, so they never get more restrictive
+  commit_ids than with COMMIT_ORDER.
+
+  A new history is only started under the commit_id of a group commit
+  if no transaction was given that commit_id yet. Once a transaction of
+  the group commit got the commit_id without being in the history (its
+  writeset is unknown, or it intersects with a history that already has
+  the commit_id), the history stays closed for the rest of the group
+  commit, so that no later transaction can join those transactions.
+
+  @param entry      the transaction
+  @param commit_id  the commit_id of the group commit of entry
+  @return the commit_id for the GTID event of entry
+*/
+uint64
+MYSQL_BIN_LOG::writeset_commit_id(group_commit_entry *entry, uint64 commit_id)
+{
+  mysql_mutex_assert_owner(&LOCK_log);
+  binlog_cache_mngr *mngr= entry->cache_mngr;
+  const uint32 domain_id= entry->thd->variables.gtid_domain_id;
+  const bool known= !mngr->writeset_unknown && mngr->writeset.elements() &&
+    entry->using_trx_cache && mngr->stmt_cache.empty() &&
+    !entry->thd->transaction->xid_state.is_explicit_XA();
+
+  if (commit_id && commit_id == writeset_history.closed_commit_id)
+    return commit_id;
+
+  if (known && writeset_history.commit_id &&
+      writeset_history.domain_id == domain_id &&
+      writeset_history.add(mngr->writeset.front(), mngr->writeset.elements()))
+    return writeset_history.commit_id;
+
+  /* Start a new group of transactions. */
+  const uint64 id= commit_id ? commit_id : uint64(entry->thd->query_id);
+  if (known && writeset_history.commit_id != id &&
+      writeset_history.start(opt_binlog_dependency_history_size) &&
+      writeset_history.add(mngr->writeset.front(), mngr->writeset.elements()))
+  {
+    writeset_history.commit_id= id;
+    writeset_history.domain_id= domain_id;
+    return id;
+  }
+  /*
+    No later transaction may join this one, except those of the same
+    group commit.
+  */
+  writeset_history.commit_id= 0;
+  writeset_history.closed_commit_id= commit_id;
+  return commit_id;
+}
+
+
 int
 MYSQL_BIN_LOG::write_transaction_or_stmt(group_commit_entry *entry,
                                          uint64 commit_id)
@@ -9027,6 +9563,7 @@ void MYSQL_BIN_LOG::close(uint exiting)
 
   if (log_state == LOG_OPENED)
   {
+    wait_for_sync_stage();
     DBUG_ASSERT(log_type == LOG_BIN);
 #ifdef HAVE_REPLICATION
     if (exiting & LOG_CLOSE_STOP_EVENT)
@@ -9065,6 +9602,8 @@ void MYSQL_BIN_LOG::close(uint exiting)
     }
 #endif /* HAVE_REPLICATION */
 
+    close_gtid_index();
+
     /* don't pwrite in a file opened with O_APPEND - it doesn't work */
     if (log_file.type == WRITE_CACHE && !(exiting & LOG_CLOSE_DELAYED_CLOSE))
     {
@@ -11880,6 +12419,22 @@ static struct st_mysql_sys_var *binlog_sys_vars[]=
 };
 
 
+/**
+  Account for one event body compressed with log_bin_compress.
+
+  @param len             length of the uncompressed data
+  @param compressed_len  length of the compressed data
+  @param time_us         time spent compressing, in microseconds
+*/
+void binlog_compression_account(size_t len, size_t compressed_len,
+                                ulonglong time_us)
+{
+  binlog_compression_bytes_in+= len;
+  binlog_compression_bytes_out+= compressed_len;
+  binlog_compression_time+= time_us;
+}
+
+
 /*
   Copy out the non-directory part of binlog position filename for the
   `binlog_snapshot_file' status variable, same way as it is done for
@@ -11916,6 +12471,10 @@ TC_LOG_BINLOG::set_status_variables(THD *thd)
     mysql_mutex_unlock(&thd->LOCK_thd_data);
   }
 
+  binlog_status_compression_bytes_in= binlog_compression_bytes_in;
+  binlog_status_compression_bytes_out= binlog_compression_bytes_out;
+  binlog_status_compression_time= binlog_compression_time;
+
   mysql_mutex_lock(&LOCK_commit_ordered);
   binlog_status_var_num_commits= this->num_commits;
   binlog_status_var_num_group_commits= this->num_group_commits;
@@ -11930,6 +12489,11 @@ TC_LOG_BINLOG::set_status_variables(THD *thd)
   binlog_status_group_commit_trigger_timeout= this->group_commit_trigger_timeout;
   binlog_status_group_commit_trigger_lock_wait= this->group_commit_trigger_lock_wait;
   mysql_mutex_unlock(&LOCK_prepare_ordered);
+  for (uint i= 0; i < BINLOG_STAGE_COUNT; i++)
+  {
+    binlog_status_stage_queue[i]= stage_queue[i];
+    binlog_status_stage_wait_time[i]= stage_wait_time[i];
+  }
 }
 
 
@@ -89,11 +89,12 @@ class TC_LOG
 */
 extern mysql_mutex_t LOCK_prepare_ordered;
 extern mysql_cond_t COND_prepare_ordered;
+extern mysql_mutex_t LOCK_binlog_sync;
 extern mysql_mutex_t LOCK_after_binlog_sync;
 extern mysql_mutex_t LOCK_commit_ordered;
 #ifdef HAVE_PSI_INTERFACE
 extern PSI_mutex_key key_LOCK_prepare_ordered, key_LOCK_commit_ordered;
-extern PSI_mutex_key key_LOCK_after_binlog_sync;
+extern PSI_mutex_key key_LOCK_binlog_sync, key_LOCK_after_binlog_sync;
 extern PSI_cond_key key_COND_prepare_ordered;
 #endif
 
@@ -424,6 +425,81 @@ class binlog_cache_data;
 struct rpl_gtid;
 struct wait_for_commit;
 
+/*
+  Stages of binlog group commit. Each stage is protected by its own mutex,
+  which the group commit leader takes hand-over-hand, so that one group
+  can be in each stage at the same time.
+*/
+enum enum_binlog_commit_stage
+{
+  BINLOG_STAGE_FLUSH= 0,                        /* LOCK_log */
+  BINLOG_STAGE_SYNC,                            /* LOCK_binlog_sync */
+  BINLOG_STAGE_COMMIT,                          /* LOCK_commit_ordered */
+  BINLOG_STAGE_COUNT
+};
+
+/* Values of @@binlog_transaction_dependency_tracking */
+enum enum_binlog_dependency_tracking
+{
+  BINLOG_DEPENDENCY_TRACKING_COMMIT_ORDER= 0,
+  BINLOG_DEPENDENCY_TRACKING_WRITESET= 1
+};
+
+/*
+  The writesets of the transactions that were given the same commit_id
+  most recently, for binlog_transaction_dependency_tracking=WRITESET.
+
+  A transaction whose writeset does not intersect with the writesets in
+  the history may share the commit_id, so that a parallel slave can apply
+  it concurrently with them, even if it did not group commit with them on
+  the master. The history is protected by LOCK_log.
+*/
+class Binlog_writeset_history
+{
+  /*
+    Open addressing hash table of (generation << 32 | hash). A slot whose
+    generation differs from m_generation is empty, so that start() does
+    not need to clear the table.
+  */
+  uint64 *m_slots;
+  size_t m_size;
+  /* Maximum number of hashes; at most half of m_size */
+  size_t m_max;
+  size_t m_count;
+  uint32 m_generation;
+
+  bool contains(uint32 hash) const;
+public:
+  /* commit_id of the transactions in the history, 0 if none may join */
+  uint64 commit_id;
+  /*
+    commit_id of the group commit whose remaining transactions may not
+    start a new history, because some of its transactions were given the
+    commit_id without being in the history
+  */
+  uint64 closed_commit_id;
+  /* GTID domain of the transactions in the history */
+  uint32 domain_id;
+
+  Binlog_writeset_history()
+    : m_slots(NULL), m_size(0), m_max(0), m_count(0), m_generation(0),
+      commit_id(0), closed_commit_id(0), domain_id(0)
+  { }
+  ~Binlog_writeset_history() { my_free(m_slots); }
+
+  /*
+    Empty the history.
+    @param max_size  maximum number of hashes to keep
+    @return false if out of memory
+  */
+  bool start(size_t max_size);
+  /*
+    Add the writeset of a transaction, unless it intersects with the history.
+    @return whether the writeset was added
+  */
+  bool add(const uint32 *hashes, size_t n);
+};
+
 class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
 {
 #ifdef HAVE_PSI_INTERFACE
@@ -552,10 +628,19 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   /* The reason why the group commit was grouped */
   ulonglong group_commit_trigger_count, group_commit_trigger_timeout;
   ulonglong group_commit_trigger_lock_wait;
+  /*
+    Number of group commit leaders waiting to enter each stage, and the
+    total time in microseconds spent waiting for it.
+  */
+  Atomic_counter<uint32> stage_queue[BINLOG_STAGE_COUNT];
+  Atomic_counter<ulonglong> stage_wait_time[BINLOG_STAGE_COUNT];
 
   /* binlog encryption data */
   struct Binlog_crypt_data crypto;
 
+  /* For binlog_transaction_dependency_tracking=WRITESET */
+  Binlog_writeset_history writeset_history;
+
   /* pointer to the sync period variable, for binlog this will be
      sync_binlog_period, for relay log this will be
      sync_relay_log_period
@@ -564,6 +649,10 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   uint sync_counter;
   bool state_file_deleted;
   bool binlog_state_recover_done;
+  /* GTID index of the binlog file being written, see binlog_gtid_index_span */
+  File gtid_index_file;
+  ulong gtid_index_span;
+  my_off_t gtid_index_next_pos;
 
   inline uint get_sync_period()
   {
@@ -571,6 +660,26 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   }
 
   int write_to_file(IO_CACHE *cache);
+  void open_gtid_index();
+  void write_gtid_index_entry();
+  void close_gtid_index();
+  void enter_commit_stage(enum_binlog_commit_stage stage,
+                          mysql_mutex_t *lock);
+  bool sync_log_file(File fd);
+  /*
+    Wait until a group commit that is syncing the binlog without holding
+    LOCK_log has completed. As the caller holds LOCK_log, no new group
+    can enter the sync stage meanwhile.
+  */
+  void wait_for_sync_stage()
+  {
+    mysql_mutex_assert_owner(&LOCK_log);
+    if (!is_relay_log)
+    {
+      mysql_mutex_lock(&LOCK_binlog_sync);
+      mysql_mutex_unlock(&LOCK_binlog_sync);
+    }
+  }
   /*
     This is used to start writing to a new log file. The difference from
     new_file() is locking. new_file_without_locking() does not acquire
@@ -581,6 +690,7 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   void do_checkpoint_request(ulong binlog_id);
   void purge();
   int write_transaction_or_stmt(group_commit_entry *entry, uint64 commit_id);
+  uint64 writeset_commit_id(group_commit_entry *entry, uint64 commit_id);
   int queue_for_group_commit(group_commit_entry *entry);
   bool write_transaction_to_binlog_events(group_commit_entry *entry);
   void trx_group_commit_leader(group_commit_entry *leader);
@@ -788,9 +898,11 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
       unlock_binlog_end_pos();
     }
   }
+  /* The caller holds LOCK_log or, in group commit, LOCK_binlog_sync. */
   void update_binlog_end_pos(my_off_t pos)
   {
-    mysql_mutex_assert_owner(&LOCK_log);
+    DBUG_ASSERT(mysql_mutex_is_owner(&LOCK_log) ||
+                mysql_mutex_is_owner(&LOCK_binlog_sync));
     mysql_mutex_assert_not_owner(&LOCK_binlog_end_pos);
     lock_binlog_end_pos();
     /*
@@ -1187,6 +1299,11 @@ File open_binlog(IO_CACHE *log, const char *log_file_name,
 void make_default_log_name(char **out, const char* log_ext, bool once);
 void binlog_reset_cache(THD *thd);
 bool write_annotated_row(THD *thd);
+void binlog_writeset_add_row(THD *thd, TABLE *table, bool is_trans,
+                             const uchar *before_record,
+                             const uchar *after_record);
+void binlog_compression_account(size_t len, size_t compressed_len,
+                                ulonglong time_us);
 
 extern MYSQL_PLUGIN_IMPORT MYSQL_BIN_LOG mysql_bin_log;
 extern handlerton *binlog_hton;
@@ -1195,6 +1312,11 @@ extern LOGGER logger;
 extern const char *log_bin_index;
 extern const char *log_bin_basename;
 
+struct rpl_binlog_state;
+void binlog_gtid_index_name(char *to, const char *log_name);
+bool binlog_gtid_index_entry(String *to, my_off_t offset,
+                             rpl_binlog_state *state);
+
 /**
   Turns a relative log binary log path into a full path, based on the
   opt_bin_logname or opt_relay_logname.
@@ -916,6 +916,52 @@ int Log_event::read_log_event(IO_CACHE* file, String* packet,
   DBUG_RETURN(0);
 }
 
+/**
+  Message for an error returned by read_log_event(IO_CACHE*, String*, ...)
+*/
+
+const char *Log_event::read_log_event_error(int error)
+{
+  switch (error)
+  {
+    case LOG_READ_BOGUS:
+      return "Event invalid";
+    case LOG_READ_IO:
+      return "read error";
+    case LOG_READ_MEM:
+      return "Out of memory";
+    case LOG_READ_TRUNC:
+      return "Event truncated";
+    case LOG_READ_TOO_LARGE:
+      return "Event too big";
+    case LOG_READ_DECRYPT:
+      return "Event decryption failure";
+    case LOG_READ_CHECKSUM_FAILURE:
+    default:
+      DBUG_ASSERT(0);
+      return "internal error";
+  }
+}
+
+/**
+  Report an event that could not be read or decoded to the error log
+
+  @param event  the raw event, or what could be read of it
+  @param error  the reason
+*/
+
+void Log_event::print_read_log_event_error(const String &event,
+                                           const char *error)
+{
+  if (event.length() >= OLD_HEADER_LEN)
+    sql_print_error("Error in Log_event::read_log_event(): '%s',"
+                    " data_len: %lu, event_type: %u", error,
+                    (ulong) uint4korr(&event[EVENT_LEN_OFFSET]),
+                    (uint) (uchar)event[EVENT_TYPE_OFFSET]);
+  else
+    sql_print_error("Error in Log_event::read_log_event(): '%s'", error);
+}
+
 Log_event* Log_event::read_log_event(IO_CACHE* file, int *out_error,
                                      const Format_description_log_event *fdle,
                                      my_bool crc_check,
@@ -928,35 +974,12 @@ Log_event* Log_event::read_log_event(IO_CACHE* file, int *out_error,
   Log_event *res= 0;
 
   *out_error= 0;
-  switch (read_log_event(file, &event, fdle, BINLOG_CHECKSUM_ALG_OFF))
+  if (int read_error= read_log_event(file, &event, fdle,
+                                     BINLOG_CHECKSUM_ALG_OFF))
   {
-    case 0:
-      break;
-    case LOG_READ_EOF: // no error here; we are at the file's end
-      goto err;
-    case LOG_READ_BOGUS:
-      error= "Event invalid";
-      goto err;
-    case LOG_READ_IO:
-      error= "read error";
-      goto err;
-    case LOG_READ_MEM:
-      error= "Out of memory";
-      goto err;
-    case LOG_READ_TRUNC:
-      error= "Event truncated";
-      goto err;
-    case LOG_READ_TOO_LARGE:
-      error= "Event too big";
-      goto err;
-    case LOG_READ_DECRYPT:
-      error= "Event decryption failure";
-      goto err;
-    case LOG_READ_CHECKSUM_FAILURE:
-    default:
-      DBUG_ASSERT(0);
-      error= "internal error";
-      goto err;
+    if (read_error != LOG_READ_EOF) // no error at the file's end
+      error= read_log_event_error(read_error);
+    goto err;
   }
 
   /*
@@ -999,13 +1022,7 @@ Log_event* Log_event::read_log_event(IO_CACHE* file, int *out_error,
       DBUG_RETURN(res);
 #endif
 
-    if (event.length() >= OLD_HEADER_LEN)
-      sql_print_error("Error in Log_event::read_log_event(): '%s',"
-                      " data_len: %lu, event_type: %u", error,
-                      (ulong) uint4korr(&event[EVENT_LEN_OFFSET]),
-                      (uint) (uchar)event[EVENT_TYPE_OFFSET]);
-    else
-      sql_print_error("Error in Log_event::read_log_event(): '%s'", error);
+    print_read_log_event_error(event, error);
   }
   DBUG_RETURN(res);
 }
@@ -3325,7 +3342,7 @@ Rows_log_event::Rows_log_event(const uchar *buf, uint event_len,
     m_extra_row_data(0)
 #if !defined(MYSQL_CLIENT) && defined(HAVE_REPLICATION)
     , m_curr_row(NULL), m_curr_row_end(NULL),
-    m_key(NULL), m_key_info(NULL), m_key_nr(0),
+    m_key(NULL), m_key_info(NULL), m_key_nr(0), m_hash_scan(NULL),
     master_had_triggers(0)
 #endif
 {
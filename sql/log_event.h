@@ -824,6 +824,7 @@ class THD;
 
 class Format_description_log_event;
 class Relay_log_info;
+class Rows_hash_scan;
 class binlog_cache_data;
 
 bool copy_event_cache_to_file_and_reinit(IO_CACHE *cache, FILE *file);
@@ -1376,6 +1377,11 @@ class Log_event
   static int read_log_event(IO_CACHE* file, String* packet,
                             const Format_description_log_event *fdle,
                             enum enum_binlog_checksum_alg checksum_alg_arg);
+  /* Message for an error returned by the method above */
+  static const char *read_log_event_error(int error);
+  /* Report an event that could not be read to the error log */
+  static void print_read_log_event_error(const String &event,
+                                         const char *error);
   /* 
      The value is set by caller of FD constructor and
      Log_event::write_header() for the rest.
@@ -5128,6 +5134,7 @@ class Rows_log_event : public Log_event
 #endif
 
 #ifdef MYSQL_SERVER
+  bool write() override;
   bool write_data_header() override;
   bool write_data_body() override;
   virtual bool write_compressed();
@@ -5229,6 +5236,7 @@ class Rows_log_event : public Log_event
   uchar    *m_key;      /* Buffer to keep key value during searches */
   KEY      *m_key_info; /* Pointer to KEY info for m_key_nr */
   uint      m_key_nr;   /* Key number */
+  Rows_hash_scan *m_hash_scan; /* Rows found by hash_scan_rows() */
   bool master_had_triggers;     /* set after tables opening */
 
   /*
@@ -5278,6 +5286,8 @@ class Rows_log_event : public Log_event
 
   int find_key(); // Find a best key to use in find_row()
   int find_row(rpl_group_info *);
+  int prefetch_rows(rpl_group_info *);
+  int hash_scan_rows(rpl_group_info *);
   int write_row(rpl_group_info *, const bool);
   int update_sequence();
 
@@ -1356,6 +1356,23 @@ bool Query_log_event::write()
          write_footer();
 }
 
+/**
+  Compress the body of an event that is being written to the binary log,
+  and account for it in the Binlog_compression_* status variables.
+*/
+static int binlog_event_compress(const uchar *src, uchar *dst, uint32 len,
+                                 uint32 *comlen)
+{
+  ulonglong start= microsecond_interval_timer();
+  int res= DBUG_EVALUATE_IF("binlog_event_compress_fail", 1,
+                            binlog_buf_compress(src, dst, len, comlen));
+  if (!res)
+    binlog_compression_account(len, *comlen,
+                               microsecond_interval_timer() - start);
+  return res;
+}
+
+
 bool Query_compressed_log_event::write()
 {
   uchar *buffer;
@@ -1365,7 +1382,7 @@ bool Query_compressed_log_event::write()
   compressed_size= alloc_size= binlog_get_compress_len(q_len);
   buffer= (uchar*) my_safe_alloca(alloc_size);
   if (buffer &&
-      !binlog_buf_compress((uchar*) query, buffer, q_len, &compressed_size))
+      !binlog_event_compress((uchar*) query, buffer, q_len, &compressed_size))
   {
     /*
       Write the compressed event. We have to temporarily store the event
@@ -5332,7 +5349,7 @@ Rows_log_event::Rows_log_event(THD *thd_arg, TABLE *tbl_arg,
     m_type(event_type), m_extra_row_data(0)
 #ifdef HAVE_REPLICATION
     , m_curr_row(NULL), m_curr_row_end(NULL),
-    m_key(NULL), m_key_info(NULL), m_key_nr(0),
+    m_key(NULL), m_key_info(NULL), m_key_nr(0), m_hash_scan(NULL),
     master_had_triggers(0)
 #endif
 {
@@ -5475,6 +5492,84 @@ inline void restore_empty_query_table_list(LEX *lex)
 }
 
 
+/**
+  The before images of the rows of an UPDATE or DELETE rows event, hashed
+  on their column values, and the positions hash_scan_rows() found them at.
+*/
+
+class Rows_hash_scan
+{
+  struct Row
+  {
+    uint32 hash;                      /* Must be first, it is the hash key */
+    const uchar *row;                 /* Before image in the event */
+    uchar *record;                    /* Before image, unpacked */
+    uchar *pos;                       /* Position in the table, or NULL */
+    Row *next;                        /* Next row of the event */
+  };
+
+  MEM_ROOT mem_root;
+  HASH rows;
+  Row *first, **last, *cursor;
+  uint found;
+
+  static uint32 record_hash(TABLE *table)
+  {
+    Hasher hasher;
+    for (Field **field= table->field; *field; field++)
+      (*field)->hash(&hasher);
+    return hasher.finalize();
+  }
+
+public:
+  Rows_hash_scan() : first(NULL), last(&first), cursor(NULL), found(0)
+  {
+    init_alloc_root(PSI_INSTRUMENT_ME, &mem_root, 8192, 0, MYF(0));
+    my_hash_init(PSI_INSTRUMENT_ME, &rows, &my_charset_bin, 64, 0,
+                 sizeof(uint32), NULL, NULL, 0);
+  }
+  ~Rows_hash_scan()
+  {
+    my_hash_free(&rows);
+    free_root(&mem_root, MYF(0));
+  }
+
+  uint count() const { return (uint) rows.records; }
+  bool all_found() const { return found == rows.records; }
+
+  /** Add the row of the event at row, unpacked in record[0] */
+  bool add(TABLE *table, const uchar *row)
+  {
+    Row *r= (Row*) alloc_root(&mem_root, sizeof(Row));
+    if (!r ||
+        !(r->record= (uchar*) memdup_root(&mem_root, table->record[0],
+                                          table->s->reclength)))
+      return true;
+    r->hash= record_hash(table);
+    r->row= row;
+    r->pos= NULL;
+    r->next= NULL;
+    *last= r;
+    last= &r->next;
+    cursor= first;
+    return my_hash_insert(&rows, (uchar*) r);
+  }
+
+  bool match(TABLE *table);
+
+  /**
+    @return the position of the row of the event at row, or NULL if it
+    was not found. The rows must be looked up in event order.
+  */
+  const uchar *position(const uchar *row)
+  {
+    while (cursor && cursor->row < row)
+      cursor= cursor->next;
+    return cursor && cursor->row == row ? cursor->pos : NULL;
+  }
+};
+
+
 int Rows_log_event::do_apply_event(rpl_group_info *rgi)
 {
   Relay_log_info const *rli= rgi->rli;
@@ -5842,8 +5937,25 @@ int Rows_log_event::do_apply_event(rpl_group_info *rgi)
     rgi->set_row_stmt_start_timestamp();
 
     THD_STAGE_INFO(thd, stage_executing);
+    bool prefetch_failed= false;
+    if (!error && (get_general_type_code() == UPDATE_ROWS_EVENT ||
+                   get_general_type_code() == DELETE_ROWS_EVENT))
+    {
+      /* These use the table as find_row() would */
+      THD* old_thd= table->in_use;
+      if (!table->in_use)
+        table->in_use= thd;
+      prefetch_failed= ((error= prefetch_rows(rgi)) ||
+                        (error= hash_scan_rows(rgi)));
+      table->in_use= old_thd;
+    }
+
     do
     {
+      /* A failed lookup may have rolled back the transaction already */
+      if (unlikely(prefetch_failed))
+        break;
+
       /* in_use can have been set to NULL in close_tables_for_reopen */
       THD* old_thd= table->in_use;
       if (!table->in_use)
@@ -5907,6 +6019,9 @@ int Rows_log_event::do_apply_event(rpl_group_info *rgi)
     } // row processing loop
     while (error == 0 && (m_curr_row != m_rows_end));
 
+    delete m_hash_scan;
+    m_hash_scan= NULL;
+
     /*
       Restore the sql_mode after the rows event is processed.
     */
@@ -6185,25 +6300,85 @@ bool Rows_log_event::write_data_body()
 }
 
 
+bool Rows_log_event::write()
+{
+  /*
+    Whether to create a compressed event is decided from the length of
+    the first row only (see THD::binlog_write_row() and friends). An event
+    that accumulated many short rows may still be big enough to be worth
+    compressing, so look again at the full row buffer before writing it.
+  */
+  const Log_event_type type= m_type;
+  Log_event_type compressed_type;
+  switch (type) {
+  case WRITE_ROWS_EVENT_V1:
+    compressed_type= WRITE_ROWS_COMPRESSED_EVENT_V1;
+    break;
+  case UPDATE_ROWS_EVENT_V1:
+    compressed_type= UPDATE_ROWS_COMPRESSED_EVENT_V1;
+    break;
+  case DELETE_ROWS_EVENT_V1:
+    compressed_type= DELETE_ROWS_COMPRESSED_EVENT_V1;
+    break;
+  case WRITE_ROWS_EVENT:
+    compressed_type= WRITE_ROWS_COMPRESSED_EVENT;
+    break;
+  case UPDATE_ROWS_EVENT:
+    compressed_type= UPDATE_ROWS_COMPRESSED_EVENT;
+    break;
+  case DELETE_ROWS_EVENT:
+    compressed_type= DELETE_ROWS_COMPRESSED_EVENT;
+    break;
+  default:
+    return Log_event::write();
+  }
+
+  if (!binlog_should_compress((size_t) (m_rows_cur - m_rows_buf)))
+    return Log_event::write();
+
+  m_type= compressed_type;
+  bool res= write_compressed();
+  m_type= type;
+  return res;
+}
+
+
+/**
+  Write the event with its rows compressed. If the compression fails,
+  write the event with the corresponding uncompressed type instead.
+*/
 bool Rows_log_event::write_compressed()
 {
   uchar *m_rows_buf_tmp= m_rows_buf;
   uchar *m_rows_cur_tmp= m_rows_cur;
-  bool ret= true;
+  bool ret;
   uint32 comlen, alloc_size;
   comlen= alloc_size= binlog_get_compress_len((uint32)(m_rows_cur_tmp -
                                                        m_rows_buf_tmp));
-  m_rows_buf= (uchar*) my_safe_alloca(alloc_size);
-  if(m_rows_buf &&
-     !binlog_buf_compress(m_rows_buf_tmp, m_rows_buf,
-                          (uint32)(m_rows_cur_tmp - m_rows_buf_tmp), &comlen))
+  uchar *buf= (uchar*) my_safe_alloca(alloc_size);
+  if (buf &&
+      !binlog_event_compress(m_rows_buf_tmp, buf,
+                             (uint32)(m_rows_cur_tmp - m_rows_buf_tmp),
+                             &comlen))
+  {
+    m_rows_buf= buf;
+    m_rows_cur= comlen + buf;
+    ret= Log_event::write();
+    m_rows_buf= m_rows_buf_tmp;
+    m_rows_cur= m_rows_cur_tmp;
+  }
+  else
   {
-    m_rows_cur= comlen + m_rows_buf;
+    const Log_event_type type= m_type;
+    DBUG_ASSERT(LOG_EVENT_IS_ROW_COMPRESSED(type));
+    m_type= type >= WRITE_ROWS_COMPRESSED_EVENT
+      ? Log_event_type(type - WRITE_ROWS_COMPRESSED_EVENT + WRITE_ROWS_EVENT)
+      : Log_event_type(type - WRITE_ROWS_COMPRESSED_EVENT_V1 +
+                       WRITE_ROWS_EVENT_V1);
     ret= Log_event::write();
+    m_type= type;
   }
-  my_safe_afree(m_rows_buf, alloc_size);
-  m_rows_buf= m_rows_buf_tmp;
-  m_rows_cur= m_rows_cur_tmp;
+  my_safe_afree(buf, alloc_size);
   return ret;
 }
 
@@ -7840,7 +8015,8 @@ static bool record_compare(TABLE *table, bool vers_from_plain= false)
   Find the best key to use when locating the row in @c find_row().
 
   A primary key is preferred if it exists; otherwise a unique index is
-  preferred. Else we pick the index with the smalles rec_per_key value.
+  preferred. Else we pick the index with the smalles rec_per_key value,
+  unless INDEX_SCAN is not in @@slave_rows_search_algorithms.
 
   If a suitable key is found, set @c m_key, @c m_key_nr and @c m_key_info
   member fields appropriately.
@@ -7877,6 +8053,9 @@ int Rows_log_event::find_key()
       best_key= key;
       break;
     }
+    if (!(slave_rows_search_algorithms_options &
+          (1ULL << SLAVE_ROWS_INDEX_SCAN)))
+      continue;
     /*
       We can only use a non-unique key if it allows range scans (ie. skip
       FULLTEXT indexes and such).
@@ -8233,6 +8412,23 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
   }
   else
   {
+    /* Use the position of the row found by hash_scan_rows(), if any */
+    const uchar *pos;
+    if (m_hash_scan && (pos= m_hash_scan->position(m_curr_row)))
+    {
+      DBUG_PRINT("info",("locating record using its position (rnd_pos)"));
+      if (likely(!(error= table->file->ha_rnd_init_with_error(0))))
+      {
+        if (likely(!(error= table->file->ha_rnd_pos(table->record[0],
+                                                    (uchar*) pos))) &&
+            !record_compare(table, m_vers_from_plain))
+          goto end;
+        table->file->ha_rnd_end();
+      }
+      /* The row has changed since the scan: search for it below */
+      error= 0;
+    }
+
     DBUG_PRINT("info",("locating record using table scan (rnd_next)"));
     /* We use this to test that the correct key is used in test cases. */
     DBUG_EXECUTE_IF("slave_crash_if_table_scan", abort(););
@@ -8291,6 +8487,247 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
   DBUG_RETURN(error);
 }
 
+
+static int prefetch_key_cmp(void *arg, const void *key1, const void *key2)
+{
+  KEY *key_info= (KEY*) arg;
+  return key_tuple_cmp(key_info->key_part, (const uchar*) key1,
+                       (const uchar*) key2, key_info->key_length);
+}
+
+
+/**
+  Read the rows of an UPDATE or DELETE rows event in key order.
+
+  With @@slave_rows_prefetch, the rows that find_row() is about to locate
+  one at a time, in the order of the event, are first all read through the
+  primary key (or a unique key without NULLable parts), sorted by key.
+  A bulk update then finds its rows in the cache of the engine, rather
+  than doing a random read for each of them.
+
+  Rows that are not found are ignored here, find_row() reports them.
+
+  The rows are locked as they are read, in key order rather than in the
+  order of the master, and a missing row takes a gap lock under REPEATABLE
+  READ. Parallel replication workers could then deadlock with each other,
+  so this is only done by the serial applier, in the READ COMMITTED or
+  READ UNCOMMITTED isolation level.
+
+  @return 0 or a handler error, already reported, that must stop the
+  applying of the event
+*/
+
+int Rows_log_event::prefetch_rows(rpl_group_info *rgi)
+{
+  TABLE *table= m_table;
+  const uchar *saved_row= m_curr_row, *saved_row_end= m_curr_row_end;
+  DYNAMIC_ARRAY keys;
+  KEY *key_info;
+  uint key_nr, key_length;
+  ulonglong n_found= 0;
+  int error= 0;
+  DBUG_ENTER("Rows_log_event::prefetch_rows");
+
+  if (!opt_slave_rows_prefetch || rgi->is_parallel_exec ||
+      thd->tx_isolation > ISO_READ_COMMITTED || table->versioned() ||
+      static_cast<RPL_TABLE_LIST*>(table->pos_in_table_list)->m_conv_table)
+    DBUG_RETURN(0);
+
+  if ((table->file->ha_table_flags() & HA_PRIMARY_KEY_REQUIRED_FOR_POSITION) &&
+      table->s->primary_key < MAX_KEY)
+    key_nr= table->s->primary_key;
+  else if (m_key_info &&
+           (m_key_info->flags & (HA_NOSAME | HA_NULL_PART_KEY)) == HA_NOSAME)
+    key_nr= m_key_nr;
+  else
+    DBUG_RETURN(0);                             // Rows are not looked up by key
+  key_info= table->key_info + key_nr;
+  key_length= key_info->key_length;
+
+  if (my_init_dynamic_array(PSI_INSTRUMENT_ME, &keys, key_length,
+                            64, 64, MYF(0)))
+    DBUG_RETURN(0);
+
+  /* Collect the key of the before image of every row */
+  while (m_curr_row != m_rows_end)
+  {
+    uchar *key;
+    prepare_record(table, m_width, FALSE);
+    if (unpack_current_row(rgi) ||
+        !(key= (uchar*) alloc_dynamic(&keys)))
+      goto end;
+    key_copy(key, table->record[0], key_info, 0);
+    if (get_general_type_code() == UPDATE_ROWS_EVENT)
+    {
+      /* Step over the after image */
+      m_curr_row= m_curr_row_end;
+      if (unpack_current_row(rgi, &m_cols_ai))
+        goto end;
+    }
+    m_curr_row= m_curr_row_end;
+  }
+
+  if (keys.elements < 2)
+    goto end;
+
+  my_qsort2(keys.buffer, keys.elements, key_length, prefetch_key_cmp,
+            key_info);
+
+  if (unlikely((error= table->file->ha_index_init(key_nr, FALSE))))
+  {
+    table->file->print_error(error, MYF(0));
+    goto end;
+  }
+  for (uint i= 0; i < keys.elements; i++)
+  {
+    uchar *key= dynamic_element(&keys, i, uchar*);
+    if (i && !prefetch_key_cmp(key_info, key - key_length, key))
+      continue;                                 // Same row more than once
+    error= table->file->ha_index_read_map(table->record[0], key, HA_WHOLE_KEY,
+                                          HA_READ_KEY_EXACT);
+    if (!error)
+      n_found++;
+    else if (error == HA_ERR_KEY_NOT_FOUND || error == HA_ERR_END_OF_FILE)
+      error= 0;
+    else
+    {
+      table->file->print_error(error, MYF(0));
+      break;
+    }
+  }
+  table->file->ha_index_end();
+  statistic_add(slave_rows_prefetched, n_found, &LOCK_status);
+  DBUG_PRINT("info", ("prefetched %u rows of %s using key %s", keys.elements,
+                      table->s->table_name.str, key_info->name.str));
+
+end:
+  delete_dynamic(&keys);
+  m_curr_row= saved_row;
+  m_curr_row_end= saved_row_end;
+  DBUG_RETURN(error);
+}
+
+
+/**
+  Match the table row in record[0] with a row of the event that was not
+  found yet. record[1] is overwritten.
+
+  @return true on out of memory
+*/
+bool Rows_hash_scan::match(TABLE *table)
+{
+  HASH_SEARCH_STATE state;
+  uint32 hash= record_hash(table);
+  for (Row *r= (Row*) my_hash_first(&rows, (uchar*) &hash, sizeof hash,
+                                    &state);
+       r;
+       r= (Row*) my_hash_next(&rows, (uchar*) &hash, sizeof hash, &state))
+  {
+    if (r->pos)
+      continue;
+    memcpy(table->record[1], r->record, table->s->reclength);
+    if (record_compare(table))
+      continue;
+    table->file->position(table->record[0]);
+    if (!(r->pos= (uchar*) memdup_root(&mem_root, table->file->ref,
+                                       table->file->ref_length)))
+      return true;
+    found++;
+    break;
+  }
+  return false;
+}
+
+
+/**
+  Find all the rows of an UPDATE or DELETE rows event in one table scan.
+
+  When HASH_SCAN is in @@slave_rows_search_algorithms and find_row() would
+  scan the table once for every row of the event, the before images of
+  the rows are hashed and matched with the rows of the table in a single
+  scan. find_row() then reads each row through its position, still in
+  the order of the event.
+
+  Rows that are not found are left for find_row() to search and report.
+
+  @return 0 or a handler error, already reported, that must stop the
+  applying of the event
+*/
+
+int Rows_log_event::hash_scan_rows(rpl_group_info *rgi)
+{
+  TABLE *table= m_table;
+  const uchar *saved_row= m_curr_row, *saved_row_end= m_curr_row_end;
+  Rows_hash_scan *scan;
+  int error= 0;
+  DBUG_ENTER("Rows_log_event::hash_scan_rows");
+  DBUG_ASSERT(!m_hash_scan);
+
+  /*
+    Tables with virtual columns or type conversions are not hashed, as
+    their blob values would not survive the unpacking of the next row.
+  */
+  if (!(slave_rows_search_algorithms_options &
+        (1ULL << SLAVE_ROWS_HASH_SCAN)) ||
+      m_key_info || table->versioned() || table->vfield ||
+      ((table->file->ha_table_flags() & HA_PRIMARY_KEY_REQUIRED_FOR_POSITION) &&
+       table->s->primary_key < MAX_KEY) ||
+      static_cast<RPL_TABLE_LIST*>(table->pos_in_table_list)->m_conv_table)
+    DBUG_RETURN(0);
+
+  if (!(scan= new Rows_hash_scan()))
+    DBUG_RETURN(0);
+
+  table->use_all_columns();
+  while (m_curr_row != m_rows_end)
+  {
+    prepare_record(table, m_width, FALSE);
+    if (unpack_current_row(rgi) || scan->add(table, m_curr_row))
+      goto end;
+    if (get_general_type_code() == UPDATE_ROWS_EVENT)
+    {
+      /* Step over the after image */
+      m_curr_row= m_curr_row_end;
+      if (unpack_current_row(rgi, &m_cols_ai))
+        goto end;
+    }
+    m_curr_row= m_curr_row_end;
+  }
+
+  if (scan->count() < 2)
+    goto end;
+
+  if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
+    goto end;
+  while (!scan->all_found() &&
+         !(error= table->file->ha_rnd_next(table->record[0])))
+  {
+    if (scan->match(table))
+    {
+      error= HA_ERR_OUT_OF_MEM;
+      break;
+    }
+  }
+  table->file->ha_rnd_end();
+  if (error == HA_ERR_END_OF_FILE)
+    error= 0;
+  if (unlikely(error))
+  {
+    table->file->print_error(error, MYF(0));
+    goto end;
+  }
+  DBUG_PRINT("info", ("scanned %s for %u rows", table->s->table_name.str,
+                      scan->count()));
+  m_hash_scan= scan;
+  scan= NULL;
+
+end:
+  delete scan;
+  m_curr_row= saved_row;
+  m_curr_row_end= saved_row_end;
+  DBUG_RETURN(error);
+}
+
 #endif
 
 /*
@@ -435,6 +435,7 @@ ulong opt_binlog_rows_event_max_size;
 ulong binlog_row_metadata;
 my_bool opt_master_verify_checksum= 0;
 my_bool opt_slave_sql_verify_checksum= 1;
+my_bool opt_slave_rows_prefetch= 0;
 const char *binlog_format_names[]= {"MIXED", "STATEMENT", "ROW", NullS};
 volatile sig_atomic_t calling_initgroups= 0; /**< Used in SIGSEGV handler. */
 uint mysqld_port, select_errors, dropping_tables, ha_open_options;
@@ -459,9 +460,11 @@ ulong slave_exec_mode_options;
 ulong slave_run_triggers_for_rbr= 0;
 ulong slave_ddl_exec_mode_options= SLAVE_EXEC_MODE_IDEMPOTENT;
 ulonglong slave_type_conversions_options;
+ulonglong slave_rows_search_algorithms_options;
 ulong thread_cache_size=0;
 ulonglong binlog_cache_size=0;
 ulonglong binlog_file_cache_size=0;
+ulonglong binlog_dump_cache_size=0;
 ulonglong max_binlog_cache_size=0;
 ulong slave_max_allowed_packet= 0;
 ulonglong binlog_stmt_cache_size=0;
@@ -478,6 +481,7 @@ ulong delayed_insert_errors,flush_time;
 ulong malloc_calls;
 ulong specialflag=0;
 ulong binlog_cache_use= 0, binlog_cache_disk_use= 0;
+ulong binlog_gtid_index_hit= 0, binlog_gtid_index_miss= 0;
 ulong binlog_stmt_cache_use= 0, binlog_stmt_cache_disk_use= 0;
 ulong max_connections, max_connect_errors;
 uint max_password_errors;
@@ -488,6 +492,7 @@ ulong transactions_multi_engine;
 ulong rpl_transactions_multi_engine;
 ulong transactions_gtid_foreign_engine;
 ulonglong slave_skipped_errors;
+ulonglong slave_rows_prefetched;
 ulong feature_files_opened_with_delayed_keys= 0, feature_check_constraint= 0;
 ulonglong denied_connections;
 my_decimal decimal_zero;
@@ -531,6 +536,9 @@ ulong opt_slave_domain_parallel_threads= 0;
 ulong opt_slave_parallel_mode;
 ulong opt_binlog_commit_wait_count= 0;
 ulong opt_binlog_commit_wait_usec= 0;
+ulong opt_binlog_dependency_tracking= 0;
+ulong opt_binlog_dependency_history_size= 25000;
+ulong opt_binlog_gtid_index_span= 0;
 ulong opt_slave_parallel_max_queued= 131072;
 my_bool opt_gtid_ignore_duplicates= FALSE;
 uint opt_gtid_cleanup_batch_size= 64;
@@ -868,7 +876,7 @@ PSI_file_key key_file_binlog,  key_file_binlog_cache, key_file_binlog_index,
 PSI_file_key key_file_query_log, key_file_slow_log;
 PSI_file_key key_file_relaylog, key_file_relaylog_index,
              key_file_relaylog_cache, key_file_relaylog_index_cache;
-PSI_file_key key_file_binlog_state;
+PSI_file_key key_file_binlog_state, key_file_binlog_gtid_index;
 
 #ifdef HAVE_des
 char *des_key_file;
@@ -919,7 +927,7 @@ PSI_mutex_key key_LOCK_stats,
   key_LOCK_wakeup_ready, key_LOCK_wait_commit;
 PSI_mutex_key key_LOCK_gtid_waiting;
 
-PSI_mutex_key key_LOCK_after_binlog_sync;
+PSI_mutex_key key_LOCK_binlog_sync, key_LOCK_after_binlog_sync;
 PSI_mutex_key key_LOCK_prepare_ordered, key_LOCK_commit_ordered;
 PSI_mutex_key key_TABLE_SHARE_LOCK_share;
 PSI_mutex_key key_TABLE_SHARE_LOCK_statistics;
@@ -994,6 +1002,7 @@ static PSI_mutex_info all_server_mutexes[]=
   { &key_TABLE_SHARE_LOCK_rotation, "TABLE_SHARE::LOCK_rotation", 0},
   { &key_LOCK_error_messages, "LOCK_error_messages", PSI_FLAG_GLOBAL},
   { &key_LOCK_prepare_ordered, "LOCK_prepare_ordered", PSI_FLAG_GLOBAL},
+  { &key_LOCK_binlog_sync, "LOCK_binlog_sync", PSI_FLAG_GLOBAL},
   { &key_LOCK_after_binlog_sync, "LOCK_after_binlog_sync", PSI_FLAG_GLOBAL},
   { &key_LOCK_commit_ordered, "LOCK_commit_ordered", PSI_FLAG_GLOBAL},
   { &key_PARTITION_LOCK_auto_inc, "HA_DATA_PARTITION::LOCK_auto_inc", 0},
@@ -1123,6 +1132,7 @@ PSI_thread_key key_thread_delayed_insert,
   key_thread_one_connection, key_thread_signal_hand,
   key_thread_slave_background, key_rpl_parallel_thread;
 PSI_thread_key key_thread_ack_receiver;
+PSI_thread_key key_thread_sort;
 
 static PSI_thread_info all_server_threads[]=
 {
@@ -1133,6 +1143,7 @@ static PSI_thread_info all_server_threads[]=
   { &key_thread_signal_hand, "signal_handler", PSI_FLAG_GLOBAL},
   { &key_thread_slave_background, "slave_background", PSI_FLAG_GLOBAL},
   { &key_thread_ack_receiver, "Ack_receiver", PSI_FLAG_GLOBAL},
+  { &key_thread_sort, "sort", 0},
   { &key_rpl_parallel_thread, "rpl_parallel_thread", 0}
 };
 
@@ -1882,6 +1893,9 @@ extern "C" void unireg_abort(int exit_code)
 static void mysqld_exit(int exit_code)
 {
   DBUG_ENTER("mysqld_exit");
+#ifdef HAVE_REPLICATION
+  binlog_dump_cache_free();
+#endif
   rpl_deinit_gtid_waiting();
   rpl_deinit_gtid_slave_state();
 #ifdef WITH_WSREP
@@ -2113,6 +2127,7 @@ static void clean_up_mutexes()
   mysql_cond_destroy(&COND_server_started);
   mysql_mutex_destroy(&LOCK_prepare_ordered);
   mysql_cond_destroy(&COND_prepare_ordered);
+  mysql_mutex_destroy(&LOCK_binlog_sync);
   mysql_mutex_destroy(&LOCK_after_binlog_sync);
   mysql_mutex_destroy(&LOCK_commit_ordered);
 #ifndef EMBEDDED_LIBRARY
@@ -4381,6 +4396,8 @@ static int init_thread_environment()
   mysql_mutex_init(key_LOCK_prepare_ordered, &LOCK_prepare_ordered,
                    MY_MUTEX_INIT_SLOW);
   mysql_cond_init(key_COND_prepare_ordered, &COND_prepare_ordered, NULL);
+  mysql_mutex_init(key_LOCK_binlog_sync, &LOCK_binlog_sync,
+                   MY_MUTEX_INIT_SLOW);
   mysql_mutex_init(key_LOCK_after_binlog_sync, &LOCK_after_binlog_sync,
                    MY_MUTEX_INIT_SLOW);
   mysql_mutex_init(key_LOCK_commit_ordered, &LOCK_commit_ordered,
@@ -4429,6 +4446,7 @@ static int init_thread_environment()
 #ifdef HAVE_REPLICATION
   rpl_init_gtid_slave_state();
   rpl_init_gtid_waiting();
+  binlog_dump_cache_init();
 #endif
 
   DBUG_RETURN(0);
@@ -6909,8 +6927,69 @@ static int show_heartbeat_period(THD *thd, SHOW_VAR *var, void *buff,
 }
 
 
+static int show_sql_driver_time(THD *thd, SHOW_VAR *var, void *buff,
+                                Atomic_counter<ulonglong> Relay_log_info::*time)
+{
+  if (Master_info *mi=
+      get_master_info(&thd->variables.default_master_connection,
+                      Sql_condition::WARN_LEVEL_NOTE))
+  {
+    *((longlong *)buff)= mi->rli.*time;
+    mi->release();
+    var->type= SHOW_LONGLONG;
+    var->value= buff;
+  }
+  else
+    var->type= SHOW_UNDEF;
+  return 0;
+}
+
+static int show_sql_driver_busy_time(THD *thd, SHOW_VAR *var, void *buff,
+                                     system_status_var *, enum_var_type)
+{
+  return show_sql_driver_time(thd, var, buff,
+                              &Relay_log_info::sql_driver_busy_time);
+}
+
+static int show_sql_driver_idle_time(THD *thd, SHOW_VAR *var, void *buff,
+                                     system_status_var *, enum_var_type)
+{
+  return show_sql_driver_time(thd, var, buff,
+                              &Relay_log_info::sql_driver_idle_time);
+}
+
+static int show_sql_driver_worker_wait_time(THD *thd, SHOW_VAR *var,
+                                            void *buff, system_status_var *,
+                                            enum_var_type)
+{
+  return show_sql_driver_time(thd, var, buff,
+                              &Relay_log_info::sql_driver_worker_wait_time);
+}
+
 #endif /* HAVE_REPLICATION */
 
+#ifdef HAVE_REPLICATION
+static int show_binlog_dump_cache_hits(THD *, SHOW_VAR *var, void *buff,
+                                       system_status_var *, enum_var_type)
+{
+  ulonglong misses;
+  var->type= SHOW_LONGLONG;
+  var->value= buff;
+  binlog_dump_cache_status((ulonglong*) buff, &misses);
+  return 0;
+}
+
+static int show_binlog_dump_cache_misses(THD *, SHOW_VAR *var, void *buff,
+                                         system_status_var *, enum_var_type)
+{
+  ulonglong hits;
+  var->type= SHOW_LONGLONG;
+  var->value= buff;
+  binlog_dump_cache_status(&hits, (ulonglong*) buff);
+  return 0;
+}
+#endif
+
 static int show_open_tables(THD *, SHOW_VAR *var, void *buff,
                             system_status_var *, enum_var_type)
 {
@@ -7331,6 +7410,12 @@ SHOW_VAR status_vars[]= {
   {"Binlog_bytes_written",     (char*) offsetof(STATUS_VAR, binlog_bytes_written), SHOW_LONGLONG_STATUS},
   {"Binlog_cache_disk_use",    (char*) &binlog_cache_disk_use,  SHOW_LONG},
   {"Binlog_cache_use",         (char*) &binlog_cache_use,       SHOW_LONG},
+#ifdef HAVE_REPLICATION
+  {"Binlog_dump_cache_hits",   (char*) &show_binlog_dump_cache_hits, SHOW_SIMPLE_FUNC},
+  {"Binlog_dump_cache_misses", (char*) &show_binlog_dump_cache_misses, SHOW_SIMPLE_FUNC},
+  {"Binlog_gtid_index_hit",    (char*) &binlog_gtid_index_hit,  SHOW_LONG},
+  {"Binlog_gtid_index_miss",   (char*) &binlog_gtid_index_miss, SHOW_LONG},
+#endif
   {"Binlog_stmt_cache_disk_use",(char*) &binlog_stmt_cache_disk_use,  SHOW_LONG},
   {"Binlog_stmt_cache_use",    (char*) &binlog_stmt_cache_use,       SHOW_LONG},
   {"Busy_time",                (char*) offsetof(STATUS_VAR, busy_time), SHOW_DOUBLE_STATUS},
@@ -7452,12 +7537,16 @@ SHOW_VAR status_vars[]= {
   {"Rpl_semi_sync_master_get_ack", (char*)&rpl_semi_sync_master_get_ack, SHOW_LONGLONG},
   SHOW_FUNC_ENTRY("Rpl_semi_sync_slave_status",  &rpl_semi_sync_enabled),
   {"Rpl_semi_sync_slave_send_ack", (char*) &rpl_semi_sync_slave_send_ack, SHOW_LONGLONG},
+  {"Rpl_semi_sync_slave_coalesced_ack", (char*) &rpl_semi_sync_slave_coalesced_ack, SHOW_LONGLONG},
+  {"Rpl_semi_sync_slave_forced_ack", (char*) &rpl_semi_sync_slave_forced_ack, SHOW_LONGLONG},
 #endif /* HAVE_REPLICATION */
 #ifdef HAVE_QUERY_CACHE
   {"Qcache_free_blocks",       (char*) &query_cache.free_memory_blocks, SHOW_LONG_NOFLUSH},
   {"Qcache_free_memory",       (char*) &query_cache.free_memory, SHOW_LONG_NOFLUSH},
   {"Qcache_hits",              (char*) &query_cache.hits,       SHOW_LONG},
   {"Qcache_inserts",           (char*) &query_cache.inserts,    SHOW_LONG},
+  {"Qcache_lock_timeouts",     (char*) &query_cache.lock_timeouts, SHOW_LONG},
+  {"Qcache_lock_waits",        (char*) &query_cache.lock_waits, SHOW_LONG},
   {"Qcache_lowmem_prunes",     (char*) &query_cache.lowmem_prunes, SHOW_LONG},
   {"Qcache_not_cached",        (char*) &query_cache.refused,    SHOW_LONG},
   {"Qcache_queries_in_cache",  (char*) &query_cache.queries_in_cache, SHOW_LONG_NOFLUSH},
@@ -7481,8 +7570,12 @@ SHOW_VAR status_vars[]= {
   {"Slave_heartbeat_period",   (char*) &show_heartbeat_period, SHOW_SIMPLE_FUNC},
   {"Slave_received_heartbeats",(char*) &show_slave_received_heartbeats, SHOW_SIMPLE_FUNC},
   {"Slave_retried_transactions",(char*)&slave_retried_transactions, SHOW_LONG},
+  {"Slave_rows_prefetched",    (char*) &slave_rows_prefetched, SHOW_LONGLONG},
   {"Slave_running",            (char*) &show_slave_running,     SHOW_SIMPLE_FUNC},
   {"Slave_skipped_errors",     (char*) &slave_skipped_errors, SHOW_LONGLONG},
+  {"Slave_sql_driver_busy_time", (char*) &show_sql_driver_busy_time, SHOW_SIMPLE_FUNC},
+  {"Slave_sql_driver_idle_time", (char*) &show_sql_driver_idle_time, SHOW_SIMPLE_FUNC},
+  {"Slave_sql_driver_worker_wait_time", (char*) &show_sql_driver_worker_wait_time, SHOW_SIMPLE_FUNC},
 #endif
   {"Slow_launch_threads",      (char*) &slow_launch_threads,    SHOW_LONG},
   {"Slow_queries",             (char*) offsetof(STATUS_VAR, long_query_count), SHOW_LONG_STATUS},
@@ -7754,6 +7847,7 @@ static int mysql_init_variables(void)
   delayed_insert_errors= thread_created= 0;
   specialflag= 0;
   binlog_cache_use=  binlog_cache_disk_use= 0;
+  binlog_gtid_index_hit= binlog_gtid_index_miss= 0;
   max_used_connections= slow_launch_threads = 0;
   mysqld_user= mysqld_chroot= opt_init_file= opt_bin_logname = 0;
   prepared_stmt_count= 0;
@@ -9147,7 +9241,8 @@ static PSI_file_info all_server_files[]=
   { &key_file_trg, "trigger_name", 0},
   { &key_file_trn, "trigger", 0},
   { &key_file_init, "init", 0},
-  { &key_file_binlog_state, "binlog_state", 0}
+  { &key_file_binlog_state, "binlog_state", 0},
+  { &key_file_binlog_gtid_index, "binlog_gtid_index", 0}
 };
 #endif /* HAVE_PSI_INTERFACE */
 
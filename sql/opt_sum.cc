@@ -84,6 +84,8 @@ static ulonglong get_exact_record_count(List<TABLE_LIST> &tables)
   List_iterator<TABLE_LIST> ti(tables);
   while ((tl= ti++))
   {
+    if (tl->table->file->pre_records())
+      return ULONGLONG_MAX;
     ha_rows tmp= tl->table->file->records();
     if (tmp == HA_POS_ERROR)
       return ULONGLONG_MAX;
@@ -44,7 +44,9 @@ Master_info::Master_info(LEX_CSTRING *connection_name_arg,
    in_start_all_slaves(0), in_stop_all_slaves(0), in_flush_all_relay_logs(0),
    users(0), killed(0),
    total_ddl_groups(0), total_non_trans_groups(0), total_trans_groups(0),
-   do_accept_own_server_id(false), semi_sync_reply_enabled(0)
+   do_accept_own_server_id(false), semi_sync_reply_enabled(0),
+   semi_sync_reply_pending(0), semi_sync_reply_deferred(0),
+   semi_sync_reply_deferred_since(0)
 {
   char *tmp;
   host[0] = 0; user[0] = 0; password[0] = 0;
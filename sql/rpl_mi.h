@@ -382,6 +382,16 @@ class Master_info : public Slave_reporting_capability
     ignored
   */
   bool semi_sync_reply_enabled;
+  /*
+    Set when a semi-sync reply was postponed because further events from
+    the master were already received; the reply is then sent for the last
+    of them (rpl_semi_sync_slave_coalesce_ack)
+  */
+  bool semi_sync_reply_pending;
+  /* Number of events that the pending semi-sync reply was postponed for */
+  uint semi_sync_reply_deferred;
+  /* microsecond_interval_timer() when the pending reply was postponed */
+  ulonglong semi_sync_reply_deferred_since;
 };
 
 int init_master_info(Master_info* mi, const char* master_info_fname,
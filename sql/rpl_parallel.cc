@@ -2297,14 +2297,24 @@ rpl_parallel_thread_pool::destroy_cond_mutex()
 */
 struct rpl_parallel_thread *
 rpl_parallel_thread_pool::get_thread(rpl_parallel_thread **owner,
-                                     rpl_parallel_entry *entry)
+                                     rpl_parallel_entry *entry,
+                                     Relay_log_info *rli)
 {
   rpl_parallel_thread *rpt;
 
   DBUG_ASSERT(count > 0);
   mysql_mutex_lock(&LOCK_rpl_thread_pool);
-  while (unlikely(busy) || !(rpt= free_list))
-    mysql_cond_wait(&COND_rpl_thread_pool, &LOCK_rpl_thread_pool);
+  if (unlikely(busy) || !free_list)
+  {
+    /* No worker is free; the SQL driver thread has to wait for one */
+    ulonglong wait_start= microsecond_interval_timer();
+    while (unlikely(busy) || !(rpt= free_list))
+      mysql_cond_wait(&COND_rpl_thread_pool, &LOCK_rpl_thread_pool);
+    rli->sql_driver_worker_wait_time+=
+      microsecond_interval_timer() - wait_start;
+  }
+  else
+    rpt= free_list;
   free_list= rpt->next;
   mysql_mutex_unlock(&LOCK_rpl_thread_pool);
   mysql_mutex_lock(&rpt->LOCK_rpl_thread);
@@ -2586,13 +2596,16 @@ rpl_parallel_entry::choose_thread(rpl_group_info *rgi, bool *did_enter_cond,
           return NULL;
         }
 
+        ulonglong wait_start= microsecond_interval_timer();
         mysql_cond_wait(&thr->COND_rpl_thread_queue, &thr->LOCK_rpl_thread);
+        rli->sql_driver_worker_wait_time+=
+          microsecond_interval_timer() - wait_start;
       }
     }
   }
   if (!thr)
     cur_thr->thr= thr=
-      global_rpl_thread_pool.get_thread(&cur_thr->thr, this);
+      global_rpl_thread_pool.get_thread(&cur_thr->thr, this, rli);
 
   return thr;
 }
@@ -320,7 +320,8 @@ struct rpl_parallel_thread_pool {
   void deactivate();
   void destroy_cond_mutex();
   struct rpl_parallel_thread *get_thread(rpl_parallel_thread **owner,
-                                         rpl_parallel_entry *entry);
+                                         rpl_parallel_entry *entry,
+                                         Relay_log_info *rli);
   void release_thread(rpl_parallel_thread *rpt);
 };
 
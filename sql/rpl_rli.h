@@ -350,6 +350,16 @@ class Relay_log_info : public Slave_reporting_capability
   */
   Atomic_counter<uint32_t> executed_entries;
 
+  /*
+    Time in microseconds the SQL driver thread spent waiting for the IO
+    thread to relay more events (idle), waiting for room in the queue of a
+    parallel replication worker, and otherwise reading, dispatching or
+    executing events (busy). Only updated by the SQL driver thread.
+  */
+  Atomic_counter<ulonglong> sql_driver_idle_time;
+  Atomic_counter<ulonglong> sql_driver_worker_wait_time;
+  Atomic_counter<ulonglong> sql_driver_busy_time;
+
   /*
     If the end of the hot relay log is made of master's events ignored by the
     slave I/O thread, these two keep track of the coords (in the master's
@@ -558,9 +558,23 @@ class Repl_semi_sync_master
   /* Remove a semi-sync replication slave */
   void remove_slave();
 
-  /* It parses a reply packet and call report_reply_binlog to handle it. */
-  int report_reply_packet(uint32 server_id, const uchar *packet,
-                        ulong packet_len);
+  /* It parses a reply packet into the binlog position it acknowledges,
+   * without handling it.  The ack receiver uses it to coalesce all replies
+   * that arrived together into a single report_reply_binlog call.
+   *
+   * Input:
+   *  server_id     - (IN)  slave server id number
+   *  packet        - (IN)  the reply packet
+   *  packet_len    - (IN)  length of the reply packet
+   *  log_file_name - (OUT) binlog file name, at least FN_REFLEN+1 bytes
+   *  log_file_pos  - (OUT) binlog offset acknowledged by the slave
+   *
+   * Return:
+   *  0: success;  1: error;  -1: slave is going down
+   */
+  int read_reply_packet(uint32 server_id, const uchar *packet,
+                        ulong packet_len, char *log_file_name,
+                        my_off_t *log_file_pos);
 
   /* In semi-sync replication, reports up to which binlog position we have
    * received replies from the slave indicating that it already get the events.
@@ -232,6 +232,10 @@ void Ack_receiver::run()
   THD *thd= new THD(next_thread_id());
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  char ack_file_name[FN_REFLEN+1];
+  my_off_t ack_file_pos= 0;
+  uint32 ack_server_id= 0;
+  bool have_ack;
   DBUG_ENTER("Ack_receiver::run");
 
   my_thread_init();
@@ -318,6 +322,14 @@ void Ack_receiver::run()
     listener.clear_signal();
     mysql_mutex_lock(&m_mutex);
     set_stage_info(stage_reading_semi_sync_ack);
+    /*
+      Read all replies that have arrived, from all slaves, and report only
+      the most advanced position. A reply acknowledges every transaction
+      before its position, so the waiters of several group commits are
+      released by a single pass over the active transactions, taking
+      LOCK_binlog once instead of once per reply.
+    */
+    have_ack= false;
     Slave_ilist_iterator it(m_slaves);
     while ((slave= it++))
     {
@@ -327,15 +339,6 @@ void Ack_receiver::run()
       {
         ulong len;
 
-        /* Semi-sync packets will always be sent with pkt_nr == 1 */
-        net_clear(&net, 0);
-        net.vio= &slave->vio;
-        /*
-          Set compress flag. This is needed to support
-          Slave_compress_protocol flag enabled Slaves
-        */
-        net.compress= slave->thd->net.compress;
-
         if (unlikely(listener.is_socket_hangup(slave)))
         {
           if (global_system_variables.log_warnings > 2)
@@ -347,34 +350,71 @@ void Ack_receiver::run()
           continue;
         }
 
-        len= my_net_read(&net);
-        if (likely(len != packet_error))
+        do
         {
-          int res;
-          res= repl_semisync_master.report_reply_packet(slave->server_id(),
-                                                        net.read_pos, len);
-          if (unlikely(res < 0))
+          char log_file_name[FN_REFLEN+1];
+          my_off_t log_file_pos;
+
+          /* Semi-sync packets will always be sent with pkt_nr == 1 */
+          net_clear(&net, 0);
+          net.vio= &slave->vio;
+          /*
+            Set compress flag. This is needed to support
+            Slave_compress_protocol flag enabled Slaves
+          */
+          net.compress= slave->thd->net.compress;
+
+          len= my_net_read(&net);
+          if (likely(len != packet_error))
           {
-            /*
-              Slave has sent COM_QUIT or other failure.
-              Delete it from listener
-            */
-            it.remove();
-            m_slaves_changed= true;
+            int res;
+            res= repl_semisync_master.read_reply_packet(slave->server_id(),
+                                                        net.read_pos, len,
+                                                        log_file_name,
+                                                        &log_file_pos);
+            if (unlikely(res < 0))
+            {
+              /*
+                Slave has sent COM_QUIT or other failure.
+                Delete it from listener
+              */
+              it.remove();
+              m_slaves_changed= true;
+              break;
+            }
+            if (res == 0 &&
+                (!have_ack ||
+                 Active_tranx::compare(log_file_name, log_file_pos,
+                                       ack_file_name, ack_file_pos) > 0))
+            {
+              strmake_buf(ack_file_name, log_file_name);
+              ack_file_pos= log_file_pos;
+              ack_server_id= slave->server_id();
+              have_ack= true;
+            }
           }
-        }
-        else if (net.last_errno == ER_NET_READ_ERROR)
-        {
-          if (net.last_errno > 0 && global_system_variables.log_warnings > 2)
-            sql_print_warning("Semisync ack receiver got error %d \"%s\" "
-                              "from slave server-id %d",
-                              net.last_errno, ER_DEFAULT(net.last_errno),
-                              slave->server_id());
-          it.remove();
-          m_slaves_changed= true;
-        }
+          else
+          {
+            if (net.last_errno == ER_NET_READ_ERROR)
+            {
+              if (net.last_errno > 0 &&
+                  global_system_variables.log_warnings > 2)
+                sql_print_warning("Semisync ack receiver got error %d \"%s\" "
+                                  "from slave server-id %d",
+                                  net.last_errno, ER_DEFAULT(net.last_errno),
+                                  slave->server_id());
+              it.remove();
+              m_slaves_changed= true;
+            }
+            break;
+          }
+          /* Drain the replies that are already buffered for this slave */
+        } while (slave->vio.read_pos < slave->vio.read_end);
       }
     }
+    if (have_ack)
+      repl_semisync_master.report_reply_binlog(ack_server_id, ack_file_name,
+                                               ack_file_pos);
     mysql_mutex_unlock(&m_mutex);
   }
 
@@ -23,9 +23,20 @@ Repl_semi_sync_slave repl_semisync_slave;
 
 my_bool global_rpl_semi_sync_slave_enabled= 0;
 char rpl_semi_sync_slave_delay_master;
+my_bool rpl_semi_sync_slave_coalesce_ack;
 ulong rpl_semi_sync_slave_trace_level;
 unsigned int rpl_semi_sync_slave_kill_conn_timeout;
 unsigned long long rpl_semi_sync_slave_send_ack = 0;
+unsigned long long rpl_semi_sync_slave_coalesced_ack = 0;
+unsigned long long rpl_semi_sync_slave_forced_ack = 0;
+
+/*
+  Limits for postponing a semi-sync reply, so that a continuous stream of
+  events from the master cannot hold the reply back until the master
+  times out waiting for it
+*/
+static const uint SEMI_SYNC_MAX_DEFERRED_EVENTS= 64;
+static const ulonglong SEMI_SYNC_MAX_DEFERRED_USEC= 1000;
 
 int Repl_semi_sync_slave::init_object()
 {
@@ -36,6 +47,7 @@ int Repl_semi_sync_slave::init_object()
   /* References to the parameter works after set_options(). */
   set_trace_level(rpl_semi_sync_slave_trace_level);
   set_delay_master(rpl_semi_sync_slave_delay_master);
+  set_coalesce_ack(rpl_semi_sync_slave_coalesce_ack);
   set_kill_conn_timeout(rpl_semi_sync_slave_kill_conn_timeout);
   return result;
 }
@@ -113,6 +125,7 @@ void Repl_semi_sync_slave::slave_start(Master_info *mi)
 
   set_slave_enabled(semi_sync);
   mi->semi_sync_reply_enabled= 0;
+  mi->semi_sync_reply_pending= 0;
 
   sql_print_information("Slave I/O thread: Start %s replication to\
  master '%s@%s:%d' in log '%s' at position %lu",
@@ -123,6 +136,8 @@ void Repl_semi_sync_slave::slave_start(Master_info *mi)
 
   /*clear the counter*/
   rpl_semi_sync_slave_send_ack= 0;
+  rpl_semi_sync_slave_coalesced_ack= 0;
+  rpl_semi_sync_slave_forced_ack= 0;
 }
 
 void Repl_semi_sync_slave::slave_stop(Master_info *mi)
@@ -257,6 +272,7 @@ int Repl_semi_sync_slave::request_transmit(Master_info *mi)
     return 1;
   }
   mi->semi_sync_reply_enabled= 1;
+  mi->semi_sync_reply_pending= 0;
   /* Inform net_server that pkt_nr can come out of order */
   mi->mysql->net.pkt_nr_can_be_reset= 1;
   mysql_free_result(mysql_store_result(mysql));
@@ -307,3 +323,40 @@ int Repl_semi_sync_slave::slave_reply(Master_info *mi)
   }
   DBUG_RETURN(reply_res);
 }
+
+bool Repl_semi_sync_slave::defer_reply(Master_info *mi)
+{
+  NET *net= &mi->mysql->net;
+  DBUG_ENTER("Repl_semi_sync_slave::defer_reply");
+
+  /*
+    Only data that is already received may postpone the reply: the IO
+    thread never blocks reading from the master with a reply outstanding,
+    so the master is never waiting for an ack that the slave is holding
+  */
+  bool buffered= net->remain_in_buf ||
+    (net->vio && net->vio->has_data(net->vio));
+  DBUG_EXECUTE_IF("semisync_slave_reply_data_buffered", buffered= true;);
+  if (is_coalesce_ack() && buffered)
+  {
+    const ulonglong now= microsecond_interval_timer();
+    if (!mi->semi_sync_reply_pending)
+    {
+      mi->semi_sync_reply_deferred= 0;
+      mi->semi_sync_reply_deferred_since= now;
+    }
+    /* Reply anyway if the events keep coming */
+    if (mi->semi_sync_reply_deferred < SEMI_SYNC_MAX_DEFERRED_EVENTS &&
+        now - mi->semi_sync_reply_deferred_since < SEMI_SYNC_MAX_DEFERRED_USEC)
+    {
+      if (mi->semi_ack & SEMI_SYNC_NEED_ACK)
+        rpl_semi_sync_slave_coalesced_ack++;
+      mi->semi_sync_reply_deferred++;
+      mi->semi_sync_reply_pending= 1;
+      DBUG_RETURN(true);
+    }
+    rpl_semi_sync_slave_forced_ack++;
+  }
+  mi->semi_sync_reply_pending= 0;
+  DBUG_RETURN(false);
+}
@@ -61,6 +61,14 @@ class Repl_semi_sync_slave
     m_delay_master = enabled;
   }
 
+  inline bool is_coalesce_ack(){
+    return m_coalesce_ack;
+  }
+
+  void set_coalesce_ack(bool enabled) {
+    m_coalesce_ack = enabled;
+  }
+
   void set_kill_conn_timeout(unsigned int timeout) {
     m_kill_conn_timeout = timeout;
   }
@@ -88,6 +96,19 @@ class Repl_semi_sync_slave
    * binlog position.
    */
   int slave_reply(Master_info* mi);
+
+  /* Decide whether the reply for the event just queued can be postponed.
+   * With rpl_semi_sync_slave_coalesce_ack, the reply is postponed while
+   * further events from the master are already received: a reply covers
+   * all events before its position, so the reply sent after the last of
+   * them acknowledges several group commits at once. The reply is postponed
+   * for at most SEMI_SYNC_MAX_DEFERRED_EVENTS events or
+   * SEMI_SYNC_MAX_DEFERRED_USEC microseconds.
+   *
+   * Return:
+   *  true: do not reply now;  false: reply now
+   */
+  bool defer_reply(Master_info *mi);
   void slave_start(Master_info *mi);
   void slave_stop(Master_info *mi);
   void slave_reconnect(Master_info *mi);
@@ -99,6 +120,7 @@ class Repl_semi_sync_slave
   bool m_init_done;
   bool m_slave_enabled;        /* semi-sync is enabled on the slave */
   bool m_delay_master;
+  bool m_coalesce_ack;
   unsigned int m_kill_conn_timeout;
 };
 
@@ -109,8 +131,11 @@ extern ulong rpl_semi_sync_slave_trace_level;
 extern Repl_semi_sync_slave repl_semisync_slave;
 
 extern char rpl_semi_sync_slave_delay_master;
+extern my_bool rpl_semi_sync_slave_coalesce_ack;
 extern unsigned int rpl_semi_sync_slave_kill_conn_timeout;
 extern unsigned long long rpl_semi_sync_slave_send_ack;
+extern unsigned long long rpl_semi_sync_slave_coalesced_ack;
+extern unsigned long long rpl_semi_sync_slave_forced_ack;
 
 extern int rpl_semi_sync_enabled(THD *thd, SHOW_VAR *var, void *buff,
                                  system_status_var *status_var,
@@ -5079,7 +5079,9 @@ Stopping slave I/O thread due to out-of-memory error from master");
 
       if (repl_semisync_slave.get_slave_enabled() &&
           mi->semi_sync_reply_enabled &&
-          (mi->semi_ack & SEMI_SYNC_NEED_ACK))
+          ((mi->semi_ack & SEMI_SYNC_NEED_ACK) ||
+           mi->semi_sync_reply_pending) &&
+          !repl_semisync_slave.defer_reply(mi))
       {
 #ifdef ENABLED_DEBUG_SYNC
         DBUG_EXECUTE_IF("simulate_delay_semisync_slave_reply", {
@@ -5741,7 +5743,13 @@ pthread_handler_t handle_slave_sql(void *arg)
       saved_skip_gtid_pos.free();
     }
 
-    if (exec_relay_log_event(thd, rli, serial_rgi))
+    ulonglong exec_start= microsecond_interval_timer();
+    ulonglong waited= rli->sql_driver_idle_time +
+                      rli->sql_driver_worker_wait_time;
+    int exec_res= exec_relay_log_event(thd, rli, serial_rgi);
+    rli->sql_driver_busy_time+= microsecond_interval_timer() - exec_start -
+      (rli->sql_driver_idle_time + rli->sql_driver_worker_wait_time - waited);
+    if (exec_res)
     {
 #ifdef WITH_WSREP
       if (WSREP(thd))
@@ -7743,6 +7751,63 @@ static IO_CACHE *reopen_relay_log(Relay_log_info *rli, const char **errmsg)
 }
 
 
+/**
+  Reads the next event from the hot relay log.
+
+  Only the raw event is read while holding LOCK_log. It is decoded, and its
+  checksum verified, after LOCK_log is released, so that the IO thread is
+  not kept from appending to the relay log in the meantime.
+
+  @return The event read, with log_lock released; or NULL with log_lock
+  still held, and *out_error set unless the end of the log was reached.
+*/
+static Log_event *read_hot_relay_log_event(Relay_log_info *rli,
+                                           IO_CACHE *cur_log,
+                                           mysql_mutex_t *log_lock,
+                                           int *out_error)
+{
+  const Format_description_log_event *fdle=
+    rli->relay_log.description_event_for_exec;
+  const char *error;
+  String packet;
+  Log_event *ev;
+  DBUG_ENTER("read_hot_relay_log_event");
+
+  mysql_mutex_assert_owner(log_lock);
+  *out_error= 0;
+  if (int read_error= Log_event::read_log_event(cur_log, &packet, fdle,
+                                                BINLOG_CHECKSUM_ALG_OFF))
+  {
+    if (read_error == LOG_READ_EOF)
+      DBUG_RETURN(NULL);
+    error= Log_event::read_log_event_error(read_error);
+    /* Do not leave the error to interfere with the writes of the IO thread */
+    cur_log->error= 0;
+  }
+  else
+  {
+    rli->future_event_relay_log_pos= my_b_tell(cur_log);
+    /*
+      Only the SQL thread changes description_event_for_exec, so it can
+      still be used to decode the event without LOCK_log
+    */
+    mysql_mutex_unlock(log_lock);
+    if ((ev= Log_event::read_log_event((uchar*) packet.ptr(), packet.length(),
+                                       &error, fdle,
+                                       opt_slave_sql_verify_checksum, false)))
+    {
+      ev->register_temp_buf((uchar*) packet.release(), true);
+      DBUG_RETURN(ev);
+    }
+    mysql_mutex_lock(log_lock);
+  }
+
+  *out_error= 1;
+  Log_event::print_read_log_event_error(packet, error);
+  DBUG_RETURN(NULL);
+}
+
+
 /**
   Reads next event from the relay log.  Should be called from the
   slave IO thread.
@@ -7846,20 +7911,21 @@ static Log_event* next_event(rpl_group_info *rgi, ulonglong *event_size)
     */
     old_pos= rli->event_relay_log_pos;
     int error;
-    if ((ev= Log_event::read_log_event(cur_log, &error,
-                                       rli->relay_log.description_event_for_exec,
-                                       opt_slave_sql_verify_checksum)))
-
+    if (hot_log)
+      ev= read_hot_relay_log_event(rli, cur_log, log_lock, &error);
+    else if ((ev= Log_event::read_log_event(cur_log, &error,
+                                  rli->relay_log.description_event_for_exec,
+                                  opt_slave_sql_verify_checksum)))
     {
       /*
         read it while we have a lock, to avoid a mutex lock in
         inc_event_relay_log_pos()
       */
       rli->future_event_relay_log_pos= my_b_tell(cur_log);
+    }
+    if (ev)
+    {
       *event_size= rli->future_event_relay_log_pos - old_pos;
-
-      if (hot_log)
-        mysql_mutex_unlock(log_lock);
       DBUG_RETURN(ev);
     }
     if (opt_reckless_slave)                     // For mysql-test
@@ -8020,7 +8086,9 @@ static Log_event* next_event(rpl_group_info *rgi, ulonglong *event_size)
         mysql_cond_broadcast(&rli->log_space_cond);
         mysql_mutex_unlock(&rli->log_space_lock);
         // Note that wait_for_update_relay_log unlocks lock_log !
+        ulonglong wait_start= microsecond_interval_timer();
         rli->relay_log.wait_for_update_relay_log(rli->sql_driver_thd);
+        rli->sql_driver_idle_time+= microsecond_interval_timer() - wait_start;
         // re-acquire data lock since we released it earlier
         mysql_mutex_lock(&rli->data_lock);
         continue;
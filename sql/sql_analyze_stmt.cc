@@ -37,6 +37,10 @@ void Filesort_tracker::print_json_members(Json_writer *writer)
   {
     writer->add_member("r_total_time_ms").
             add_double(time_tracker.get_time_ms());
+    writer->add_member("r_sort_time_ms").
+            add_double(sort_time_tracker.get_time_ms());
+    writer->add_member("r_merge_time_ms").
+            add_double(merge_time_tracker.get_time_ms());
   }
   if (r_limit != HA_POS_ERROR)
   {
@@ -309,6 +309,31 @@ class Filesort_tracker : public Sql_alloc
     sort_passes += passes;
   }
 
+  /*
+    Time spent sorting the keys in the sort buffer, and merging the sorted
+    chunks that did not fit into the buffer. Only measured in ANALYZE.
+  */
+  inline void report_sort_start(THD *thd)
+  {
+    if (unlikely(time_tracker.timed))
+      sort_time_tracker.start_tracking(thd);
+  }
+  inline void report_sort_end(THD *thd)
+  {
+    if (unlikely(time_tracker.timed))
+      sort_time_tracker.stop_tracking(thd);
+  }
+  inline void report_merge_start(THD *thd)
+  {
+    if (unlikely(time_tracker.timed))
+      merge_time_tracker.start_tracking(thd);
+  }
+  inline void report_merge_end(THD *thd)
+  {
+    if (unlikely(time_tracker.timed))
+      merge_time_tracker.stop_tracking(thd);
+  }
+
   inline void report_sort_buffer_size(size_t bufsize)
   {
     if (sort_buffer_size)
@@ -352,6 +377,8 @@ class Filesort_tracker : public Sql_alloc
   }
 private:
   Time_and_counter_tracker time_tracker;
+  Exec_time_tracker sort_time_tracker;
+  Exec_time_tracker merge_time_tracker;
 
   //ulonglong r_loops; /* How many times filesort was invoked */
   /*
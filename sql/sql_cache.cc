@@ -601,7 +601,7 @@ void inline fix_local_query_cache_mode(THD *thd)
 
 bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
 {
-  bool interrupt= TRUE;
+  bool interrupt= TRUE, waited= FALSE;
   Query_cache_wait_state wait_state(thd, __func__, __FILE__, __LINE__);
   DBUG_ENTER("Query_cache::try_lock");
 
@@ -637,6 +637,11 @@ bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
     else
     {
       DBUG_ASSERT(m_cache_lock_status == Query_cache::LOCKED);
+      if (!waited)
+      {
+        lock_waits++;
+        waited= TRUE;
+      }
       /*
         To prevent send_result_to_client() and query_cache_insert() from
         blocking execution for too long a timeout is put on the lock.
@@ -652,7 +657,10 @@ bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
         int res= mysql_cond_timedwait(&COND_cache_status_changed,
                                       &structure_guard_mutex, &waittime);
         if (res == ETIMEDOUT)
+        {
+          lock_timeouts++;
           break;
+        }
       }
       else
       {
@@ -663,6 +671,7 @@ bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
         */
         DBUG_ASSERT(m_requests_in_progress > 1);
         DBUG_ASSERT(mode == TRY);
+        lock_timeouts++;
         break;
       }
     }
@@ -1277,7 +1286,7 @@ Query_cache::Query_cache(size_t query_cache_limit_arg,
   :query_cache_size(0),
    query_cache_limit(query_cache_limit_arg),
    queries_in_cache(0), hits(0), inserts(0), refused(0),
-   total_blocks(0), lowmem_prunes(0),
+   total_blocks(0), lowmem_prunes(0), lock_waits(0), lock_timeouts(0),
    m_cache_status(OK),
    min_allocation_unit(ALIGN_SIZE(min_allocation_unit_arg)),
    min_result_data_size(ALIGN_SIZE(min_result_data_size_arg)),
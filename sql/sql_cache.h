@@ -305,6 +305,11 @@ class Query_cache
   /* statistics */
   size_t free_memory, queries_in_cache, hits, inserts, refused,
     free_memory_blocks, total_blocks, lowmem_prunes;
+  /*
+    Lock contention: how many times the cache was found locked by another
+    thread, and how many of those gave up on the cache instead of waiting.
+  */
+  size_t lock_waits, lock_timeouts;
 
 
 private:
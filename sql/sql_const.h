@@ -98,6 +98,7 @@
 
 #define MAX_SORT_MEMORY 2048*1024
 #define MIN_SORT_MEMORY 1024
+#define MAX_SORT_PARALLEL_THREADS 64
 
 /* Some portable defines */
 
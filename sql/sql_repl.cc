@@ -1000,15 +1000,19 @@ get_binlog_list(MEM_ROOT *memroot, bool reverse= true,
   Gtid_list_log_event where D is not present in the requested slave state at
   all. Since if D is not in requested slave state, it means that slave needs
   to start at the very first GTID in domain D.
+
+  The same check is done against the binlog state at an entry of the GTID
+  index of a binlog file, see gtid_index_find_start().
 */
 static bool
-contains_all_slave_gtid(slave_connection_state *st, Gtid_list_log_event *glev)
+contains_all_slave_gtid(slave_connection_state *st, const rpl_gtid *list,
+                        uint32 count)
 {
   uint32 i;
 
-  for (i= 0; i < glev->count; ++i)
+  for (i= 0; i < count; ++i)
   {
-    uint32 gl_domain_id= glev->list[i].domain_id;
+    uint32 gl_domain_id= list[i].domain_id;
     const rpl_gtid *gtid= st->find(gl_domain_id);
     if (!gtid)
     {
@@ -1018,15 +1022,15 @@ contains_all_slave_gtid(slave_connection_state *st, Gtid_list_log_event *glev)
       */
       return false;
     }
-    if (gtid->server_id == glev->list[i].server_id &&
-        gtid->seq_no <= glev->list[i].seq_no)
+    if (gtid->server_id == list[i].server_id &&
+        gtid->seq_no <= list[i].seq_no)
     {
       /*
         The slave needs to start after gtid, but it is contained in an earlier
         binlog file. So we need to search back further, unless it was the very
         last gtid logged for the domain in earlier binlog files.
       */
-      if (gtid->seq_no < glev->list[i].seq_no)
+      if (gtid->seq_no < list[i].seq_no)
         return false;
 
       /*
@@ -1039,7 +1043,7 @@ contains_all_slave_gtid(slave_connection_state *st, Gtid_list_log_event *glev)
         beginning of this group, per the special case explained in comment at
         the start of this function. If not, then we need to search back further.
       */
-      if (i+1 < glev->count && gl_domain_id == glev->list[i+1].domain_id)
+      if (i+1 < count && gl_domain_id == list[i+1].domain_id)
         return false;
     }
   }
@@ -1048,6 +1052,69 @@ contains_all_slave_gtid(slave_connection_state *st, Gtid_list_log_event *glev)
 }
 
 
+/*
+  Adjust the slave state and the UNTIL state for starting to send binlog at
+  a point where the binlog state is LIST, for which contains_all_slave_gtid()
+  returned true.
+*/
+static void
+adjust_slave_start_state(slave_connection_state *state, const rpl_gtid *list,
+                         uint32 count,
+                         slave_connection_state *until_gtid_state)
+{
+  uint32 i;
+
+  /*
+    As a special case, we allow to start from binlog file N if the
+    requested GTID is the last event (in the corresponding domain) in
+    binlog file (N-1), but then we need to remove that GTID from the slave
+    state, rather than skipping events waiting for it to turn up.
+
+    If slave is doing START SLAVE UNTIL, check for any UNTIL conditions
+    that are already included in a previous binlog file. Delete any such
+    from the UNTIL hash, to mark that such domains have already reached
+    their UNTIL condition.
+  */
+  for (i= 0; i < count; ++i)
+  {
+    const rpl_gtid *gtid= state->find(list[i].domain_id);
+    if (!gtid)
+    {
+      /*
+        Contains_all_slave_gtid() returns false if there is any domain in
+        Gtid_list_event which is not in the requested slave position.
+
+        We may delete a domain from the slave state inside this loop, but
+        we only do this when it is the very last GTID logged for that
+        domain in earlier binlogs, and then we can not encounter it in any
+        further GTIDs in the Gtid_list.
+      */
+      DBUG_ASSERT(0);
+    } else if (gtid->server_id == list[i].server_id &&
+               gtid->seq_no == list[i].seq_no)
+    {
+      /*
+        The slave requested to start from the very beginning of this
+        domain in this binlog file. So delete the entry from the state,
+        we do not need to skip anything.
+      */
+      state->remove(gtid);
+    }
+
+    if (until_gtid_state &&
+        (gtid= until_gtid_state->find(list[i].domain_id)) &&
+        gtid->server_id == list[i].server_id &&
+        gtid->seq_no <= list[i].seq_no)
+    {
+      /*
+        We've already reached the stop position in UNTIL for this domain,
+        since it is before the start position.
+      */
+      until_gtid_state->remove(gtid);
+    }
+  }
+}
+
 static void
 give_error_start_pos_missing_in_binlog(int *err, const char **errormsg,
                                        rpl_gtid *error_gtid)
@@ -1345,64 +1412,13 @@ gtid_find_binlog_file(slave_connection_state *state, char *out_name,
     if (unlikely(errormsg))
       goto end;
 
-    if (!glev || contains_all_slave_gtid(state, glev))
+    if (!glev || contains_all_slave_gtid(state, glev->list, glev->count))
     {
       strmake(out_name, buf, FN_REFLEN);
 
       if (glev)
-      {
-        uint32 i;
-
-        /*
-          As a special case, we allow to start from binlog file N if the
-          requested GTID is the last event (in the corresponding domain) in
-          binlog file (N-1), but then we need to remove that GTID from the slave
-          state, rather than skipping events waiting for it to turn up.
-
-          If slave is doing START SLAVE UNTIL, check for any UNTIL conditions
-          that are already included in a previous binlog file. Delete any such
-          from the UNTIL hash, to mark that such domains have already reached
-          their UNTIL condition.
-        */
-        for (i= 0; i < glev->count; ++i)
-        {
-          const rpl_gtid *gtid= state->find(glev->list[i].domain_id);
-          if (!gtid)
-          {
-            /*
-              Contains_all_slave_gtid() returns false if there is any domain in
-              Gtid_list_event which is not in the requested slave position.
-
-              We may delete a domain from the slave state inside this loop, but
-              we only do this when it is the very last GTID logged for that
-              domain in earlier binlogs, and then we can not encounter it in any
-              further GTIDs in the Gtid_list.
-            */
-            DBUG_ASSERT(0);
-          } else if (gtid->server_id == glev->list[i].server_id &&
-                     gtid->seq_no == glev->list[i].seq_no)
-          {
-            /*
-              The slave requested to start from the very beginning of this
-              domain in this binlog file. So delete the entry from the state,
-              we do not need to skip anything.
-            */
-            state->remove(gtid);
-          }
-
-          if (until_gtid_state &&
-              (gtid= until_gtid_state->find(glev->list[i].domain_id)) &&
-              gtid->server_id == glev->list[i].server_id &&
-              gtid->seq_no <= glev->list[i].seq_no)
-          {
-            /*
-              We've already reached the stop position in UNTIL for this domain,
-              since it is before the start position.
-            */
-            until_gtid_state->remove(gtid);
-          }
-        }
-      }
+        adjust_slave_start_state(state, glev->list, glev->count,
+                                 until_gtid_state);
 
       goto end;
     }
@@ -1623,6 +1639,336 @@ gtid_state_from_pos(const char *name, uint32 offset,
 }
 
 
+/*
+  Scan binlog file NAME and write its GTID index (see binlog_gtid_index_span
+  and binlog_gtid_index_name()), for a file whose index is missing or was
+  not completed, eg. because the server crashed while writing it.
+
+  The index is written to a temporary file which is then renamed, so dump
+  threads rebuilding the same index concurrently do not interfere.
+
+  Returns true on error.
+*/
+static bool
+gtid_index_rebuild(THD *thd, const char *name, ulong span)
+{
+  IO_CACHE cache;
+  File file, index_file;
+  const char *errormsg= NULL;
+  bool found_format_description_event= false;
+  bool found_gtid_list_event= false;
+  enum enum_binlog_checksum_alg current_checksum_alg= BINLOG_CHECKSUM_ALG_UNDEF;
+  Format_description_log_event *fdev= NULL;
+  rpl_binlog_state gtid_state;
+  my_off_t next_pos= 0;
+  String packet, index;
+  char index_name[FN_REFLEN], tmp_name[FN_REFLEN];
+  bool res= true;
+  int err;
+  DBUG_ENTER("gtid_index_rebuild");
+
+  if ((file= open_binlog(&cache, name, &errormsg)) == (File)-1)
+    DBUG_RETURN(true);
+  gtid_state.init();
+  if (!(fdev= new Format_description_log_event(3)))
+    goto end;
+
+  for (;;)
+  {
+    Log_event_type typ;
+    my_off_t cur_pos= my_b_tell(&cache);
+
+    packet.length(0);
+    err= Log_event::read_log_event(&cache, &packet, fdev,
+                         opt_master_verify_checksum ? current_checksum_alg
+                                                    : BINLOG_CHECKSUM_ALG_OFF);
+    if (err == LOG_READ_EOF || err == LOG_READ_TRUNC)
+      break;
+    if (unlikely(err))
+      goto end;
+    typ= (Log_event_type)(uchar)packet[EVENT_TYPE_OFFSET];
+    if (typ == FORMAT_DESCRIPTION_EVENT)
+    {
+      Format_description_log_event *tmp;
+
+      if (unlikely(found_format_description_event))
+        goto end;
+      current_checksum_alg= get_checksum_alg((uchar*) packet.ptr(),
+                                             packet.length());
+      found_format_description_event= true;
+      if (unlikely(!(tmp= new Format_description_log_event((uchar*) packet.ptr(),
+                                                           packet.length(),
+                                                           fdev))))
+        goto end;
+      delete fdev;
+      fdev= tmp;
+    }
+    else if (typ == START_ENCRYPTION_EVENT)
+    {
+      uint sele_len = packet.length();
+      if (current_checksum_alg == BINLOG_CHECKSUM_ALG_CRC32)
+        sele_len -= BINLOG_CHECKSUM_LEN;
+      Start_encryption_log_event sele((uchar*) packet.ptr(), sele_len, fdev);
+      if (fdev->start_decryption(&sele))
+        goto end;
+    }
+    else if (unlikely(!found_format_description_event))
+      goto end;
+    else if (typ == ROTATE_EVENT || typ == STOP_EVENT ||
+             typ == BINLOG_CHECKPOINT_EVENT)
+      continue;
+    else if (typ == GTID_LIST_EVENT)
+    {
+      rpl_gtid *gtid_list;
+      uint32 list_len;
+
+      if (unlikely(found_gtid_list_event) ||
+          Gtid_list_log_event::peek(packet.ptr(), packet.length(),
+                                    current_checksum_alg,
+                                    &gtid_list, &list_len, fdev))
+        goto end;
+      err= gtid_state.load(gtid_list, list_len);
+      my_free(gtid_list);
+      if (unlikely(err))
+        goto end;
+      found_gtid_list_event= true;
+    }
+    else if (!found_gtid_list_event)
+    {
+      /* Old binlog without GTIDs, the index has no entries. */
+      break;
+    }
+    else if (typ == GTID_EVENT)
+    {
+      rpl_gtid gtid;
+      uchar flags2;
+      if (unlikely(Gtid_log_event::peek((uchar*) packet.ptr(), packet.length(),
+                                        current_checksum_alg, &gtid.domain_id,
+                                        &gtid.server_id, &gtid.seq_no, &flags2,
+                                        fdev)))
+        goto end;
+      if (cur_pos >= next_pos)
+      {
+        if (binlog_gtid_index_entry(&index, cur_pos, &gtid_state))
+          goto end;
+        next_pos= cur_pos + span;
+      }
+      if (unlikely(gtid_state.update_nolock(&gtid, false)))
+        goto end;
+    }
+  }
+
+  {
+    char buf[32];
+    size_t len= my_snprintf(buf, sizeof(buf), "E %llu\n",
+                            (ulonglong) my_b_filelength(&cache));
+    if (index.append(buf, len))
+      goto end;
+  }
+
+  binlog_gtid_index_name(index_name, name);
+  my_snprintf(tmp_name, sizeof(tmp_name), "%s-%llu", index_name,
+              (ulonglong) thd->thread_id);
+  if ((index_file= mysql_file_open(key_file_binlog_gtid_index, tmp_name,
+                                   O_WRONLY|O_CREAT|O_TRUNC|O_BINARY,
+                                   MYF(MY_WME))) < 0)
+    goto end;
+  if (mysql_file_write(index_file, (uchar *) index.ptr(), index.length(),
+                       MYF(MY_WME|MY_NABP)) ||
+      mysql_file_close(index_file, MYF(MY_WME)) ||
+      mysql_file_rename(key_file_binlog_gtid_index, tmp_name, index_name,
+                        MYF(MY_WME)))
+  {
+    my_delete(tmp_name, MYF(0));
+    goto end;
+  }
+  DBUG_PRINT("info", ("rebuilt GTID index of %s", name));
+  res= false;
+
+end:
+  delete fdev;
+  end_io_cache(&cache);
+  mysql_file_close(file, MYF(MY_WME));
+  DBUG_RETURN(res);
+}
+
+
+/*
+  Read the GTID index of binlog file NAME into a buffer, which the caller
+  frees with my_free(). Returns NULL if there is no index.
+
+  *final_size is set to the binlog file size written in the final line of
+  the index, or to 0 if the index has no final line.
+*/
+static char *
+gtid_index_read(const char *name, size_t *out_len, my_off_t *final_size)
+{
+  char index_name[FN_REFLEN];
+  MY_STAT stat;
+  File file;
+  char *buf, *last;
+  size_t len;
+
+  *final_size= 0;
+  binlog_gtid_index_name(index_name, name);
+  if ((file= mysql_file_open(key_file_binlog_gtid_index, index_name,
+                             O_RDONLY|O_BINARY, MYF(0))) < 0)
+    return NULL;
+  if (mysql_file_fstat(file, &stat, MYF(0)) ||
+      !(buf= (char *) my_malloc(PSI_INSTRUMENT_ME, (len= stat.st_size) + 1,
+                                MYF(0))))
+  {
+    mysql_file_close(file, MYF(0));
+    return NULL;
+  }
+  if (mysql_file_read(file, (uchar *) buf, len, MYF(MY_NABP)))
+    len= 0;
+  mysql_file_close(file, MYF(0));
+  buf[len]= 0;
+
+  /* Only complete lines are used, the last one may still be written. */
+  while (len && buf[len-1] != '\n')
+    len--;
+  buf[len]= 0;
+  if (len > 2)
+  {
+    for (last= buf + len - 1; last > buf && last[-1] != '\n'; last--)
+      ;
+    if (last[0] == 'E' && last[1] == ' ')
+      *final_size= (my_off_t) strtoull(last + 2, NULL, 10);
+  }
+  *out_len= len;
+  return buf;
+}
+
+
+/*
+  Find the offset in binlog file NAME at which to start sending to a slave
+  that connects at the GTID position STATE.
+
+  The GTID index of the file gives the binlog state at some of its GTID
+  events. Sending starts at the last of them where the state still
+  satisfies contains_all_slave_gtid(), and STATE and UNTIL_GTID_STATE are
+  adjusted for that point the same way gtid_find_binlog_file() adjusts them
+  for the start of the file. This saves reading and skipping everything
+  before it that the slave already has. As the Gtid_list event at the start
+  of the file is then not sent, UNTIL_BINLOG_STATE is loaded from the entry
+  instead.
+
+  A missing or incomplete index of a file that is no longer written to is
+  rebuilt. Without a usable index, the file is sent from its start.
+  Binlog_gtid_index_hit and Binlog_gtid_index_miss count whether sending
+  starts at an index entry.
+*/
+static my_off_t
+gtid_index_find_start(THD *thd, slave_connection_state *state,
+                      const char *name,
+                      slave_connection_state *until_gtid_state,
+                      rpl_binlog_state *until_binlog_state)
+{
+  char end_file[FN_REFLEN];
+  my_off_t end_pos, final_size;
+  my_off_t start_pos= BIN_LOG_HEADER_SIZE;
+  ulong span= opt_binlog_gtid_index_span;
+  rpl_gtid *found= NULL;
+  uint32 found_count= 0;
+  MY_STAT stat;
+  bool active;
+  char *buf, *p, *end;
+  size_t len;
+  DBUG_ENTER("gtid_index_find_start");
+
+  if (!span)
+    DBUG_RETURN(start_pos);
+
+  mysql_bin_log.lock_binlog_end_pos();
+  end_pos= mysql_bin_log.get_binlog_end_pos(end_file);
+  mysql_bin_log.unlock_binlog_end_pos();
+  active= !strcmp(end_file, name);
+
+  buf= gtid_index_read(name, &len, &final_size);
+  if (active)
+  {
+    /*
+      The index of the active binlog is being written and has no final
+      line yet. Only its entries for events already readable are used.
+    */
+    if (final_size)
+    {
+      my_free(buf);
+      goto done;
+    }
+  }
+  else
+  {
+    if (!my_stat(name, &stat, MYF(0)))
+    {
+      my_free(buf);
+      goto done;
+    }
+    if (final_size != (my_off_t) stat.st_size)
+    {
+      my_free(buf);
+      buf= NULL;
+      if (!gtid_index_rebuild(thd, name, span))
+        buf= gtid_index_read(name, &len, &final_size);
+    }
+    end_pos= ~(my_off_t) 0;
+  }
+  if (!buf)
+    goto done;
+
+  for (p= buf, end= buf + len; p < end; )
+  {
+    char *eol= strchr(p, '\n');
+    char *list_start;
+    my_off_t offset;
+    rpl_gtid *list= NULL;
+    uint32 count= 0;
+
+    if (p[0] != 'G' || p[1] != ' ')
+      break;
+    offset= (my_off_t) strtoull(p + 2, &list_start, 10);
+    if (*list_start != ' ' || offset <= start_pos || offset > end_pos)
+      break;
+    list_start++;
+    if (list_start < eol &&
+        !(list= gtid_parse_string_to_list(list_start, eol - list_start,
+                                          &count)))
+      break;
+    if (!contains_all_slave_gtid(state, list, count))
+    {
+      my_free(list);
+      break;
+    }
+    my_free(found);
+    found= list;
+    found_count= count;
+    start_pos= offset;
+    p= eol + 1;
+  }
+  my_free(buf);
+
+  if (start_pos > BIN_LOG_HEADER_SIZE)
+  {
+    if (until_gtid_state && until_binlog_state->load(found, found_count))
+      start_pos= BIN_LOG_HEADER_SIZE;
+    else
+    {
+      adjust_slave_start_state(state, found, found_count, until_gtid_state);
+      DBUG_PRINT("info", ("starting at GTID index entry %llu",
+                          (ulonglong) start_pos));
+    }
+  }
+  my_free(found);
+done:
+  if (start_pos > BIN_LOG_HEADER_SIZE)
+    statistic_increment(binlog_gtid_index_hit, &LOCK_status);
+  else
+    statistic_increment(binlog_gtid_index_miss, &LOCK_status);
+  DBUG_RETURN(start_pos);
+}
+
 int
 gtid_state_from_binlog_pos(const char *in_name, uint32 pos, String *out_str)
 {
@@ -2226,6 +2572,18 @@ static int init_binlog_sender(binlog_send_info *info,
   // note: publish that we use file, before we open it
   thd->set_current_linfo(linfo);
 
+  if (info->using_gtid_state)
+  {
+    /*
+      Now that the file can not be purged, see if its GTID index lets us
+      skip over the part of it that the slave already has.
+    */
+    *pos= gtid_index_find_start(thd, &info->gtid_state,
+                                linfo->log_file_name, info->until_gtid_state,
+                                &info->until_binlog_state);
+    linfo->pos= *pos;
+  }
+
   if (check_start_offset(info, linfo->log_file_name, *pos))
     return 1;
 
@@ -2782,6 +3140,289 @@ static int send_events(binlog_send_info *info, IO_CACHE* log, LOG_INFO* linfo,
   return 0;
 }
 
+/*
+  Cache of binlog file blocks shared by the binlog dump threads.
+
+  Every dump thread reads the binlog through its own IO_CACHE, so with many
+  slaves the same recently written events are read from the file once per
+  slave. With binlog_dump_cache_size > 0, the dump threads serve their reads
+  from shared blocks instead, and only the first thread that needs a block
+  reads it from the file.
+
+  Only the part of a binlog file before binlog_end_pos is read, which does
+  not change afterwards, except that MYSQL_BIN_LOG::close() clears
+  LOG_EVENT_BINLOG_IN_USE_F in the first block. So the first block of the
+  active binlog is never cached, and a block is identified by the file
+  name, the block number and the RESET MASTER count (RESET MASTER reuses
+  the file names). The block at the end of the active binlog is extended
+  as the binlog grows. The blocks are direct-mapped by the block number,
+  starting at a slot that depends on the number of the binlog file, so
+  that the same block of consecutive binlog files does not compete for
+  one slot.
+*/
+class Binlog_dump_cache
+{
+  struct Block
+  {
+    mysql_rwlock_t lock;
+    char log_name[FN_REFLEN];
+    uint64 reset_count;
+    my_off_t block_no;
+    /* Number of valid bytes in data */
+    size_t length;
+    uchar *data;
+
+    bool is(const char *name, uint64 count, my_off_t no) const
+    {
+      return block_no == no && reset_count == count &&
+        !strcmp(log_name, name);
+    }
+  };
+
+  Block *blocks= nullptr;
+  size_t n_blocks= 0;
+  uchar *buffer= nullptr;
+
+public:
+  Atomic_counter<ulonglong> hits, misses;
+
+  bool enabled() const { return n_blocks != 0; }
+
+  /* The number of a binlog file, from its extension (.000001) */
+  static ulong file_no(const char *log_name)
+  {
+    return strtoul(fn_ext(log_name) + 1, NULL, 10);
+  }
+
+private:
+  /* The slot of the first block of a binlog file (Fibonacci hashing) */
+  size_t first_slot(ulong log_no) const
+  {
+    const uint64 h= (uint64{log_no} * 0x9e3779b97f4a7c15ULL) >> 32;
+    return size_t((h * n_blocks) >> 32);
+  }
+
+  /* Whether log_name is the binlog that is being written to */
+  static bool is_active(const char *log_name)
+  {
+    char active[FN_REFLEN];
+    mysql_bin_log.lock_binlog_end_pos();
+    mysql_bin_log.get_binlog_end_pos(active);
+    mysql_bin_log.unlock_binlog_end_pos();
+    return !strcmp(active, log_name);
+  }
+
+public:
+
+  void init(size_t size)
+  {
+    n_blocks= size / BINLOG_DUMP_CACHE_BLOCK_SIZE;
+    if (!n_blocks)
+      return;
+    blocks= (Block*) my_malloc(PSI_INSTRUMENT_ME, n_blocks * sizeof *blocks,
+                               MYF(MY_WME | MY_ZEROFILL));
+    buffer= (uchar*) my_malloc(PSI_INSTRUMENT_ME,
+                               n_blocks * BINLOG_DUMP_CACHE_BLOCK_SIZE,
+                               MYF(MY_WME));
+    if (!blocks || !buffer)
+    {
+      my_free(blocks);
+      my_free(buffer);
+      blocks= nullptr;
+      buffer= nullptr;
+      n_blocks= 0;
+      sql_print_warning("Could not allocate binlog_dump_cache_size=%zu "
+                        "bytes; the binlog dump cache is disabled", size);
+      return;
+    }
+    for (size_t i= 0; i < n_blocks; i++)
+    {
+      mysql_rwlock_init(PSI_NOT_INSTRUMENTED, &blocks[i].lock);
+      blocks[i].data= buffer + i * BINLOG_DUMP_CACHE_BLOCK_SIZE;
+    }
+  }
+
+  void destroy()
+  {
+    for (size_t i= 0; i < n_blocks; i++)
+      mysql_rwlock_destroy(&blocks[i].lock);
+    my_free(blocks);
+    my_free(buffer);
+    blocks= nullptr;
+    buffer= nullptr;
+    n_blocks= 0;
+  }
+
+  /**
+    Copy a range of a binlog file, reading the missing blocks from the file.
+
+    @param log_name     binlog file name
+    @param log_no       file_no(log_name)
+    @param reset_count  RESET MASTER count when the file was opened
+    @param file         the open binlog file
+    @param pos          file offset to read from
+    @param dst          buffer to copy to
+    @param count        number of bytes to copy
+    @param end          end of the readable part of the file
+
+    @retval false  success
+    @retval true   the file could not be read
+  */
+  bool read(const char *log_name, ulong log_no, uint64 reset_count,
+            File file, my_off_t pos, uchar *dst, size_t count, my_off_t end)
+  {
+    DBUG_ASSERT(pos + count <= end);
+    while (count)
+    {
+      const my_off_t block_no= pos / BINLOG_DUMP_CACHE_BLOCK_SIZE;
+      const size_t offset= size_t(pos % BINLOG_DUMP_CACHE_BLOCK_SIZE);
+      const size_t n= MY_MIN(count, BINLOG_DUMP_CACHE_BLOCK_SIZE - offset);
+      if (!block_no && is_active(log_name))
+      {
+        if (mysql_file_pread(file, dst, n, pos, MYF(MY_NABP)))
+          return true;
+        pos+= n;
+        dst+= n;
+        count-= n;
+        continue;
+      }
+      Block &b= blocks[(first_slot(log_no) + block_no % n_blocks) % n_blocks];
+
+      mysql_rwlock_rdlock(&b.lock);
+      if (b.is(log_name, reset_count, block_no) && b.length >= offset + n)
+        hits++;
+      else
+      {
+        mysql_rwlock_unlock(&b.lock);
+        mysql_rwlock_wrlock(&b.lock);
+        if (!b.is(log_name, reset_count, block_no))
+        {
+          strmake_buf(b.log_name, log_name);
+          b.reset_count= reset_count;
+          b.block_no= block_no;
+          b.length= 0;
+        }
+        if (b.length < offset + n)
+        {
+          const my_off_t start= block_no * BINLOG_DUMP_CACHE_BLOCK_SIZE;
+          const size_t want= size_t(MY_MIN(my_off_t{BINLOG_DUMP_CACHE_BLOCK_SIZE},
+                                           end - start)) - b.length;
+          size_t len= mysql_file_pread(file, b.data + b.length, want,
+                                       start + b.length, MYF(0));
+          if (len != MY_FILE_ERROR)
+            b.length+= len;
+          if (b.length < offset + n)
+          {
+            mysql_rwlock_unlock(&b.lock);
+            return true;
+          }
+        }
+        misses++;
+      }
+      memcpy(dst, b.data + offset, n);
+      mysql_rwlock_unlock(&b.lock);
+      pos+= n;
+      dst+= n;
+      count-= n;
+    }
+    return false;
+  }
+};
+
+static Binlog_dump_cache binlog_dump_cache;
+
+
+void binlog_dump_cache_init()
+{
+  binlog_dump_cache.init(size_t(binlog_dump_cache_size));
+}
+
+
+void binlog_dump_cache_free()
+{
+  binlog_dump_cache.destroy();
+}
+
+
+void binlog_dump_cache_status(ulonglong *hits, ulonglong *misses)
+{
+  *hits= binlog_dump_cache.hits;
+  *misses= binlog_dump_cache.misses;
+}
+
+
+/* The IO_CACHE of a binlog dump thread, reading through binlog_dump_cache */
+struct BINLOG_DUMP_IO_CACHE : public IO_CACHE
+{
+  const char *log_name;
+  ulong log_no;
+  uint64 reset_count;
+  int (*real_read_function)(struct st_io_cache *,uchar *,size_t);
+};
+
+
+/*
+  IO_CACHE read_function that serves the binlog of a dump thread from
+  binlog_dump_cache. It falls back to the regular read function at the end
+  of the readable part of the file, so that end-of-file is reported in the
+  usual way.
+*/
+static int binlog_dump_cache_read(IO_CACHE *file, uchar *Buffer, size_t Count)
+{
+  BINLOG_DUMP_IO_CACHE *log= static_cast<BINLOG_DUMP_IO_CACHE*>(file);
+  my_off_t pos= file->pos_in_file + (size_t) (file->read_end - file->buffer);
+
+  if (pos + Count > file->end_of_file ||
+      binlog_dump_cache.read(log->log_name, log->log_no, log->reset_count,
+                             file->file, pos, Buffer, Count,
+                             file->end_of_file))
+    return log->real_read_function(file, Buffer, Count);
+
+  /* Refill the IO_CACHE buffer with what follows, as far as is readable */
+  pos+= Count;
+  size_t length= size_t(MY_MIN(my_off_t{file->buffer_length},
+                               file->end_of_file - pos));
+  if (length &&
+      binlog_dump_cache.read(log->log_name, log->log_no, log->reset_count,
+                             file->file, pos, file->buffer, length,
+                             file->end_of_file))
+    length= 0;
+  file->pos_in_file= pos;
+  file->read_pos= file->buffer;
+  file->read_end= file->buffer + length;
+  /* The file offset no longer matches pos_in_file */
+  file->seek_not_done= 1;
+  return 0;
+}
+
+
+/*
+  Make a dump thread read the binlog file that was opened in log through
+  binlog_dump_cache.
+
+  @param log          the IO_CACHE returned by open_binlog()
+  @param log_name     name of the binlog file
+  @param reset_count  RESET MASTER count from before the file was opened
+*/
+static void binlog_dump_cache_attach(BINLOG_DUMP_IO_CACHE *log,
+                                     const char *log_name,
+                                     uint64 reset_count)
+{
+  /*
+    If RESET MASTER ran while the file was opened, we do not know which
+    incarnation of the file we got. Read it without the cache then.
+  */
+  if (!binlog_dump_cache.enabled() ||
+      reset_count != mysql_bin_log.get_reset_master_count())
+    return;
+  log->log_name= log_name;
+  log->log_no= Binlog_dump_cache::file_no(log_name);
+  log->reset_count= reset_count;
+  log->real_read_function= log->read_function;
+  log->read_function= binlog_dump_cache_read;
+}
+
+
 /**
  * This function sends one binlog file to slave
  *
@@ -2830,7 +3471,7 @@ void mysql_binlog_send(THD* thd, char* log_ident, my_off_t pos,
 {
   LOG_INFO linfo;
 
-  IO_CACHE log;
+  BINLOG_DUMP_IO_CACHE log;
   File file = -1;
   String* const packet= &thd->packet;
 
@@ -2921,11 +3562,13 @@ void mysql_binlog_send(THD* thd, char* log_ident, my_off_t pos,
       goto err;
     }
 
+    uint64 reset_count= mysql_bin_log.get_reset_master_count();
     if ((file=open_binlog(&log, linfo.log_file_name, &info->errmsg)) < 0)
     {
       info->error= ER_MASTER_FATAL_ERROR_READING_BINLOG;
       goto err;
     }
+    binlog_dump_cache_attach(&log, linfo.log_file_name, reset_count);
 
     if (send_format_descriptor_event(info, &log, &linfo, pos))
     {
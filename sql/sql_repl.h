@@ -59,6 +59,12 @@ int log_loaded_block(IO_CACHE* file, uchar *Buffer, size_t Count);
 int init_replication_sys_vars();
 void mysql_binlog_send(THD* thd, char* log_ident, my_off_t pos, ushort flags);
 
+/* Unit of caching in the binlog dump cache, see binlog_dump_cache_size */
+#define BINLOG_DUMP_CACHE_BLOCK_SIZE (64 * 1024)
+void binlog_dump_cache_init();
+void binlog_dump_cache_free();
+void binlog_dump_cache_status(ulonglong *hits, ulonglong *misses);
+
 #ifdef HAVE_PSI_INTERFACE
 extern PSI_mutex_key key_LOCK_slave_state, key_LOCK_binlog_state;
 #endif
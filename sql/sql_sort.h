@@ -25,6 +25,7 @@
 
 class Field;
 struct TABLE;
+class Filesort_tracker;
 
 /* Defines used by filesort and uniques */
 
@@ -565,6 +566,8 @@ class Sort_param {
 
   uchar *unique_buff;
   bool not_killable;
+  uint sort_threads;              // Threads for sorting the sort buffer
+  Filesort_tracker *tracker;      // NULL for Unique
   String tmp_buffer;
   // The fields below are used only by Unique class.
   qsort_cmp2 compare;
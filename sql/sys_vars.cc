@@ -2488,6 +2488,48 @@ Sys_binlog_commit_wait_usec(
        VALID_RANGE(0, ULONG_MAX), DEFAULT(100000), BLOCK_SIZE(1));
 
 
+static const char *binlog_dependency_tracking_names[]=
+  {"COMMIT_ORDER", "WRITESET", NullS};
+static Sys_var_on_access_global<Sys_var_enum,
+                     PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_DEPENDENCY_TRACKING>
+Sys_binlog_dependency_tracking(
+       "binlog_transaction_dependency_tracking",
+       "How the commit_id that lets a parallel slave run transactions "
+       "concurrently is assigned. COMMIT_ORDER: transactions get the same "
+       "commit_id only if they group committed together. WRITESET: in "
+       "addition, a transaction that modified only rows of tables with a "
+       "primary key gets the commit_id of the preceding transactions if "
+       "none of them modified a row with the same unique key values.",
+       GLOBAL_VAR(opt_binlog_dependency_tracking), CMD_LINE(REQUIRED_ARG),
+       binlog_dependency_tracking_names,
+       DEFAULT(BINLOG_DEPENDENCY_TRACKING_COMMIT_ORDER));
+
+
+static Sys_var_on_access_global<Sys_var_ulong,
+                     PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_DEPENDENCY_TRACKING>
+Sys_binlog_dependency_history_size(
+       "binlog_transaction_dependency_history_size",
+       "Maximum number of unique key hashes of the transactions that share "
+       "a commit_id when binlog_transaction_dependency_tracking=WRITESET. "
+       "When it is exceeded, the next transaction starts a new commit_id.",
+       GLOBAL_VAR(opt_binlog_dependency_history_size), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, 1000000), DEFAULT(25000), BLOCK_SIZE(1));
+
+
+static Sys_var_on_access_global<Sys_var_ulong,
+                     PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_GTID_INDEX_SPAN>
+Sys_binlog_gtid_index_span(
+       "binlog_gtid_index_span",
+       "If non-zero, write next to each binary log file an index of the GTID "
+       "binlog state, with an entry at most every this many bytes. A slave "
+       "connecting with a GTID position then starts reading the binary log "
+       "from the closest preceding entry, instead of scanning the file from "
+       "the start. A changed value takes effect from the next binary log "
+       "file.",
+       GLOBAL_VAR(opt_binlog_gtid_index_span), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, ULONG_MAX), DEFAULT(0), BLOCK_SIZE(1));
+
+
 static bool fix_max_join_size(sys_var *self, THD *thd, enum_var_type type)
 {
   SV *sv= type == OPT_GLOBAL ? &global_system_variables : &thd->variables;
@@ -3453,6 +3495,19 @@ Slave_run_triggers_for_rbr(
        slave_run_triggers_for_rbr_names,
        DEFAULT(SLAVE_RUN_TRIGGERS_FOR_RBR_NO));
 
+static Sys_var_on_access_global<Sys_var_mybool,
+                                PRIV_SET_SYSTEM_GLOBAL_VAR_SLAVE_ROWS_PREFETCH>
+Sys_slave_rows_prefetch(
+       "slave_rows_prefetch",
+       "Before applying a row-based UPDATE or DELETE event, read all its rows "
+       "through the primary key, or a unique key, in key order. This turns "
+       "the random reads of bulk updates into a sorted index scan. As the "
+       "rows are locked in key order, this is only done without parallel "
+       "replication and in the READ COMMITTED or READ UNCOMMITTED isolation "
+       "level",
+       GLOBAL_VAR(opt_slave_rows_prefetch), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static const char *slave_type_conversions_name[]= {"ALL_LOSSY", "ALL_NON_LOSSY", 0};
 static Sys_var_on_access_global<Sys_var_set,
                               PRIV_SET_SYSTEM_GLOBAL_VAR_SLAVE_TYPE_CONVERSIONS>
@@ -3465,6 +3520,22 @@ Slave_type_conversions(
        slave_type_conversions_name,
        DEFAULT(0));
 
+static const char *slave_rows_search_algorithms_name[]=
+{"INDEX_SCAN", "HASH_SCAN", 0};
+static Sys_var_on_access_global<Sys_var_set,
+                    PRIV_SET_SYSTEM_GLOBAL_VAR_SLAVE_ROWS_SEARCH_ALGORITHMS>
+Slave_rows_search_algorithms(
+       "slave_rows_search_algorithms",
+       "Set of the algorithms the slave may use to find the rows of "
+       "row-based UPDATE and DELETE events, when the table has no primary "
+       "key or unique key without NULLable parts. INDEX_SCAN searches "
+       "another index of the table. HASH_SCAN hashes all the rows of an "
+       "event and finds them in a single scan of the table. If neither "
+       "can be used, the table is scanned for every row",
+       GLOBAL_VAR(slave_rows_search_algorithms_options), CMD_LINE(REQUIRED_ARG),
+       slave_rows_search_algorithms_name,
+       DEFAULT(1ULL << SLAVE_ROWS_INDEX_SCAN));
+
 static Sys_var_on_access_global<Sys_var_mybool,
                            PRIV_SET_SYSTEM_GLOBAL_VAR_SLAVE_SQL_VERIFY_CHECKSUM>
 Sys_slave_sql_verify_checksum(
@@ -3485,6 +3556,15 @@ Sys_master_verify_checksum(
        GLOBAL_VAR(opt_master_verify_checksum), CMD_LINE(OPT_ARG),
        DEFAULT(FALSE));
 
+static Sys_var_ulonglong Sys_binlog_dump_cache_size(
+       "binlog_dump_cache_size",
+       "Size of the cache of binary log blocks that is shared by the binlog "
+       "dump threads, so that events sent to many slaves are read from the "
+       "binary log only once. 0 disables the cache",
+       READ_ONLY GLOBAL_VAR(binlog_dump_cache_size), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, SIZE_T_MAX), DEFAULT(0),
+       BLOCK_SIZE(BINLOG_DUMP_CACHE_BLOCK_SIZE));
+
 /* These names must match RPL_SKIP_XXX #defines in slave.h. */
 static const char *replicate_events_marked_for_skip_names[]= {
   "REPLICATE", "FILTER_ON_SLAVE", "FILTER_ON_MASTER", 0
@@ -3636,6 +3716,13 @@ static bool fix_rpl_semi_sync_slave_delay_master(sys_var *self, THD *thd,
   return false;
 }
 
+static bool fix_rpl_semi_sync_slave_coalesce_ack(sys_var *self, THD *thd,
+                                                 enum_var_type type)
+{
+  repl_semisync_slave.set_coalesce_ack(rpl_semi_sync_slave_coalesce_ack);
+  return false;
+}
+
 static bool fix_rpl_semi_sync_slave_kill_conn_timeout(sys_var *self, THD *thd,
                                                       enum_var_type type)
 {
@@ -3674,6 +3761,17 @@ Sys_semisync_slave_delay_master(
        NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0),
        ON_UPDATE(fix_rpl_semi_sync_slave_delay_master));
 
+static Sys_var_on_access_global<Sys_var_mybool,
+                    PRIV_SET_SYSTEM_GLOBAL_VAR_RPL_SEMI_SYNC_SLAVE_COALESCE_ACK>
+Sys_semisync_slave_coalesce_ack(
+       "rpl_semi_sync_slave_coalesce_ack",
+       "Postpone the ack for an event while further events from the master "
+       "are already received, so that one ack covers several group commits.",
+       GLOBAL_VAR(rpl_semi_sync_slave_coalesce_ack),
+       CMD_LINE(OPT_ARG), DEFAULT(FALSE),
+       NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0),
+       ON_UPDATE(fix_rpl_semi_sync_slave_coalesce_ack));
+
 static Sys_var_on_access_global<Sys_var_uint,
                PRIV_SET_SYSTEM_GLOBAL_VAR_RPL_SEMI_SYNC_SLAVE_KILL_CONN_TIMEOUT>
 Sys_semisync_slave_kill_conn_timeout(
@@ -3704,6 +3802,13 @@ static Sys_var_ulonglong Sys_sort_buffer(
        VALID_RANGE(MIN_SORT_MEMORY, SIZE_T_MAX), DEFAULT(MAX_SORT_MEMORY),
        BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_sort_parallel_threads(
+       "sort_parallel_threads",
+       "Number of threads that sort the keys collected in the sort buffer "
+       "by filesort (1=sort in the connection thread only)",
+       SESSION_VAR(sort_parallel_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, MAX_SORT_PARALLEL_THREADS), DEFAULT(1), BLOCK_SIZE(1));
+
 export sql_mode_t expand_sql_mode(sql_mode_t sql_mode)
 {
   if (sql_mode & MODE_ANSI)
@@ -1182,6 +1182,7 @@ dberr_t btr_cur_t::search_leaf(const dtuple_t *tuple, page_cur_mode_t mode,
     ut_ad(up_match != ULINT_UNDEFINED || mode != PAGE_CUR_LE);
     ut_ad(low_match != ULINT_UNDEFINED || mode != PAGE_CUR_LE);
     ++btr_cur_n_sea;
+    info->n_hash_hits++;
 
     return DB_SUCCESS;
   }
@@ -523,6 +523,28 @@ btr_pcur_move_to_next_page(
 		return DB_CORRUPTION;
 	}
 
+	const bool scan_read_ahead = srv_scan_read_ahead_pages
+		&& page_is_leaf(page) && !ibuf_inside(mtr);
+
+	if (scan_read_ahead) {
+		/* Count the pages that buf_read_ahead_scan() or
+		another read-ahead brought in before they were needed. */
+		const page_id_t next_id(
+			btr_pcur_get_block(cursor)->page.id().space(),
+			next_page_no);
+		buf_pool_t::hash_chain& chain
+			= buf_pool.page_hash.cell_get(next_id.fold());
+		transactional_shared_lock_guard<page_hash_latch> g{
+			buf_pool.page_hash.lock_get(chain)};
+		if (const buf_page_t* bpage
+		    = buf_pool.page_hash.get(next_id, chain)) {
+			if (!buf_pool.watch_is_sentinel(*bpage)
+			    && !bpage->is_accessed()) {
+				buf_pool.stat.n_ra_scan_hits++;
+			}
+		}
+	}
+
 	dberr_t err;
         bool first_access = false;
 	buf_block_t* next_block = btr_block_get(
@@ -550,6 +572,10 @@ btr_pcur_move_to_next_page(
 	if (first_access) {
 		buf_read_ahead_linear(next_block->page.id(), ibuf_inside(mtr));
 	}
+	if (scan_read_ahead) {
+		buf_read_ahead_scan(next_block->page.id(),
+				    btr_page_get_next(next_page));
+	}
 	return DB_SUCCESS;
 }
 
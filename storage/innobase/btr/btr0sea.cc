@@ -65,6 +65,65 @@ is then built on the page, assuming the global limit has been reached */
 before hash index building is started */
 #define BTR_SEARCH_BUILD_LIMIT		100U
 
+/** The number of hash index hits and updates of an index after which
+btr_search_check_throttle() reconsiders btr_search_t::throttled */
+#define BTR_SEARCH_THROTTLE_WINDOW	8192U
+
+/** The hash index of an index is throttled if more than this many hash
+index updates were needed for each search served by it */
+#define BTR_SEARCH_THROTTLE_UPDATES_PER_HIT	4U
+
+/** A throttled hash index is enabled again once at most this many hash
+index updates would have been needed for each search served by it */
+#define BTR_SEARCH_UNTHROTTLE_UPDATES_PER_HIT	2U
+
+/** Reconsider whether the adaptive hash index should be throttled for an
+index. NOTE that info is NOT protected by any semaphore, to save CPU time!
+The counters are only a heuristic.
+@param[in,out]	info	search info */
+static void btr_search_check_throttle(btr_search_t *info)
+{
+	if (info->n_hash_hits + info->n_hash_updates
+	    < DBUG_EVALUATE_IF("ahi_throttle_window_64", 64U,
+			       BTR_SEARCH_THROTTLE_WINDOW)) {
+		return;
+	}
+
+	const bool throttle = info->n_hash_updates
+		> (info->throttled
+		   ? BTR_SEARCH_UNTHROTTLE_UPDATES_PER_HIT
+		   : BTR_SEARCH_THROTTLE_UPDATES_PER_HIT) * info->n_hash_hits;
+
+	if (throttle != info->throttled) {
+		info->throttled = throttle;
+		if (throttle) {
+			MONITOR_INC(MONITOR_ADAPTIVE_HASH_INDEX_THROTTLED);
+		} else {
+			MONITOR_INC(MONITOR_ADAPTIVE_HASH_INDEX_UNTHROTTLED);
+		}
+	}
+
+	/* Let older history fade away, so that a change of the
+	workload will be noticed. */
+	info->n_hash_hits /= 2;
+	info->n_hash_updates /= 2;
+}
+
+/** Count a record insert or delete in an index whose adaptive hash index
+is throttled. The pages of such an index mostly have no hash index, but
+the hash index updates that would be needed must be weighed against the
+searches that could be served, for btr_search_check_throttle().
+@param[in]	index	index tree */
+static void btr_search_count_throttled_update(const dict_index_t *index)
+{
+	btr_search_t*	info = index->search_info;
+
+	if (info->throttled) {
+		info->n_hash_updates++;
+		btr_search_check_throttle(info);
+	}
+}
+
 /** Compute a hash value of a record in a page.
 @param[in]	rec		index record
 @param[in]	offsets		return value of rec_get_offsets()
@@ -1659,6 +1718,17 @@ void btr_search_info_update_slow(btr_search_t *info, btr_cur_t *cursor)
 
 	bool build_index = btr_search_update_block_hash_info(info, block);
 
+	if (info->throttled) {
+		/* Count the searches that the hash index would have
+		answered, so that it can be enabled again once the
+		index is read more than it is modified. */
+		if (info->n_hash_potential >= BTR_SEARCH_BUILD_LIMIT) {
+			info->n_hash_hits++;
+			btr_search_check_throttle(info);
+		}
+		build_index = false;
+	}
+
 	if (build_index || (cursor->flag == BTR_CUR_HASH_FAIL)) {
 
 		btr_search_check_free_space_in_heap(cursor->index());
@@ -1778,6 +1848,8 @@ void btr_search_update_hash_on_delete(btr_cur_t *cursor)
 		return;
 	}
 
+	btr_search_count_throttled_update(cursor->index());
+
 	block = btr_cur_get_block(cursor);
 
 	ut_ad(block->page.lock.have_x());
@@ -1792,11 +1864,14 @@ void btr_search_update_hash_on_delete(btr_cur_t *cursor)
 
 	ut_ad(!cursor->index()->table->is_temporary());
 
-	if (index != cursor->index()) {
+	if (index != cursor->index() || index->search_info->throttled) {
 		btr_search_drop_page_hash_index(block, false);
 		return;
 	}
 
+	index->search_info->n_hash_updates++;
+	btr_search_check_throttle(index->search_info);
+
 	ut_ad(block->page.id().space() == index->table->space_id);
 	ut_a(index == cursor->index());
 	ut_a(block->curr_n_fields > 0 || block->curr_n_bytes > 0);
@@ -1851,6 +1926,8 @@ void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
 		return;
 	}
 
+	btr_search_count_throttled_update(cursor->index());
+
 	rec = btr_cur_get_rec(cursor);
 
 	block = btr_cur_get_block(cursor);
@@ -1866,7 +1943,7 @@ void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
 
 	ut_ad(!cursor->index()->table->is_temporary());
 
-	if (index != cursor->index()) {
+	if (index != cursor->index() || index->search_info->throttled) {
 		ut_ad(index->id == cursor->index()->id);
 		btr_search_drop_page_hash_index(block, false);
 		return;
@@ -1887,6 +1964,9 @@ void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
 	    && (cursor->n_fields == block->curr_n_fields)
 	    && (cursor->n_bytes == block->curr_n_bytes)
 	    && !block->curr_left_side) {
+		index->search_info->n_hash_updates++;
+		btr_search_check_throttle(index->search_info);
+
 		if (const rec_t *new_rec = page_rec_get_next_const(rec)) {
 			if (ha_search_and_update_if_found(
 				&btr_search_sys.get_part(*cursor->index())
@@ -1939,6 +2019,8 @@ void btr_search_update_hash_on_insert(btr_cur_t *cursor,
 		return;
 	}
 
+	btr_search_count_throttled_update(cursor->index());
+
 	block = btr_cur_get_block(cursor);
 
 	ut_ad(block->page.lock.have_x());
@@ -1958,7 +2040,7 @@ void btr_search_update_hash_on_insert(btr_cur_t *cursor,
 
 	ut_ad(!cursor->index()->table->is_temporary());
 
-	if (index != cursor->index()) {
+	if (index != cursor->index() || index->search_info->throttled) {
 		ut_ad(index->id == cursor->index()->id);
 drop:
 		btr_search_drop_page_hash_index(block, false);
@@ -1968,6 +2050,9 @@ void btr_search_update_hash_on_insert(btr_cur_t *cursor,
 	ut_a(index == cursor->index());
 	ut_ad(!dict_index_is_ibuf(index));
 
+	index->search_info->n_hash_updates++;
+	btr_search_check_throttle(index->search_info);
+
 	n_fields = block->curr_n_fields;
 	n_bytes = block->curr_n_bytes;
 	const bool left_side = block->curr_left_side;
@@ -1141,6 +1141,28 @@ bool buf_pool_t::create()
   return false;
 }
 
+#ifdef HAVE_URING
+/** Register the chunks with io_uring if innodb_use_native_aio_register */
+void buf_pool_t::io_register() noexcept
+{
+  if (!srv_use_native_aio || !srv_use_native_aio_register)
+    return;
+  std::vector<tpool::aio_buffer> bufs;
+  bufs.reserve(n_chunks);
+  for (auto chunk= chunks; chunk != chunks + n_chunks; chunk++)
+    bufs.push_back({chunk->blocks->page.frame,
+                    chunk->size << srv_page_size_shift});
+  srv_thread_pool->register_buffers(bufs.data(), bufs.size());
+}
+
+/** Unregister the chunks from io_uring */
+void buf_pool_t::io_unregister() noexcept
+{
+  if (srv_use_native_aio_register && srv_thread_pool)
+    srv_thread_pool->unregister_buffers();
+}
+#endif
+
 /** Clean up after successful create() */
 void buf_pool_t::close() noexcept
 {
@@ -1148,6 +1170,10 @@ void buf_pool_t::close() noexcept
   if (!is_initialised())
     return;
 
+#ifdef HAVE_URING
+  io_unregister();
+#endif
+
   mysql_mutex_destroy(&mutex);
   mysql_mutex_destroy(&flush_list_mutex);
 
@@ -1711,6 +1737,13 @@ inline void buf_pool_t::resize()
 
 	chunk_t::map_reg = UT_NEW_NOKEY(chunk_t::map());
 
+#ifdef HAVE_URING
+	/* This waits for any pending I/O on the registered buffers,
+	so that the kernel no longer refers to chunks that we may free.
+	Until io_register() below, I/O will use unregistered buffers. */
+	io_unregister();
+#endif
+
 	/* add/delete chunks */
 
 	buf_resize_status("buffer pool resizing with chunks "
@@ -1837,6 +1870,10 @@ inline void buf_pool_t::resize()
 	curr_size = new_size;
 	n_chunks_new = n_chunks;
 
+#ifdef HAVE_URING
+	io_register();
+#endif
+
 	if (chunks_old) {
 		ut_free(chunks_old);
 		chunks_old = NULL;
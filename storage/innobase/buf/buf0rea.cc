@@ -684,6 +684,92 @@ ulint buf_read_ahead_linear(const page_id_t page_id, bool ibuf) noexcept
   return count;
 }
 
+ulint buf_read_ahead_scan(const page_id_t page_id, uint32_t next) noexcept
+{
+  const ulint n_pages= srv_scan_read_ahead_pages;
+  if (!n_pages || page_id.space() >= SRV_TMP_SPACE_ID)
+    return 0;
+
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return 0;
+
+  if (os_aio_pending_reads_approx() >
+      buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  fil_space_t *space= fil_space_t::get(page_id.space());
+  if (!space)
+    return 0;
+
+  const unsigned zip_size= space->zip_size();
+  const uint32_t last_page= space->last_page_number();
+  /* Whether the pages visited so far were physically consecutive */
+  bool sequential= next == page_id.page_no() + 1;
+  page_id_t id{page_id};
+  ulint count= 0;
+
+  for (ulint i= 0; i < n_pages; i++)
+  {
+    if (next == FIL_NULL || next <= 1 || next > last_page ||
+        next == id.page_no())
+      break;
+    id.set_page_no(next);
+
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(id.fold());
+    page_hash_latch &hash_lock= buf_pool.page_hash.lock_get(chain);
+    hash_lock.lock_shared();
+    const buf_page_t *bpage= buf_pool.page_hash.get(id, chain);
+    if (bpage && !buf_pool.watch_is_sentinel(*bpage))
+    {
+      if (bpage->is_read_fixed())
+      {
+        /* The successor will be known after the read completes. */
+        hash_lock.unlock_shared();
+        if (!sequential)
+          break;
+        next= id.page_no() + 1;
+        continue;
+      }
+      /* We may read uninitialized data or a stale page here; see the
+      comment in buf_read_ahead_linear(). */
+      const byte *f= bpage->frame ? bpage->frame : bpage->zip.data;
+      uint32_t n= mach_read_from_4(my_assume_aligned<4>(f + FIL_PAGE_NEXT));
+      hash_lock.unlock_shared();
+      MEM_MAKE_DEFINED(&n, sizeof n);
+      sequential= sequential && n == id.page_no() + 1;
+      next= n;
+      continue;
+    }
+    hash_lock.unlock_shared();
+
+    if (space->is_stopping() || ibuf_bitmap_page(id, zip_size))
+      break;
+    space->reacquire();
+    if (buf_read_page_low(space, false, BUF_READ_ANY_PAGE, id, zip_size,
+                          false) == DB_SUCCESS)
+      count++;
+    if (!sequential)
+      break;
+    next= id.page_no() + 1;
+  }
+
+  if (count)
+  {
+    mariadb_increment_pages_prefetched(count);
+    DBUG_PRINT("ib_buf", ("scan read-ahead %zu pages from %s: %u",
+                          count, space->chain.start->name,
+                          page_id.page_no()));
+    mysql_mutex_lock(&buf_pool.mutex);
+    buf_LRU_stat_inc_io();
+    buf_pool.stat.n_ra_pages_read_scan+= count;
+    mysql_mutex_unlock(&buf_pool.mutex);
+  }
+
+  space->release();
+  return count;
+}
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
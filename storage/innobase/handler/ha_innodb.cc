@@ -397,6 +397,23 @@ static TYPELIB innodb_deadlock_report_typelib = {
 	NULL
 };
 
+static const char *innodb_lock_schedule_algorithm_names[]= {
+	"fcfs", /* Grant waiting record locks in the order of the requests */
+	"cats", /* Grant first to the transactions that block the most */
+	NullS
+};
+
+static_assert(LOCK_SCHEDULE_FCFS == 0, "compatibility");
+static_assert(LOCK_SCHEDULE_CATS == 1, "compatibility");
+
+/** Enumeration of innodb_lock_schedule_algorithm */
+static TYPELIB innodb_lock_schedule_algorithm_typelib = {
+	array_elements(innodb_lock_schedule_algorithm_names) - 1,
+	"innodb_lock_schedule_algorithm_typelib",
+	innodb_lock_schedule_algorithm_names,
+	NULL
+};
+
 /** Allowed values of innodb_change_buffering */
 static const char* innodb_change_buffering_names[] = {
 	"none",		/* IBUF_USE_NONE */
@@ -905,6 +922,11 @@ static MYSQL_THDVAR_UINT(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
   "Timeout in seconds an InnoDB transaction may wait for a lock before being rolled back. The value 100000000 is infinite timeout.",
   NULL, NULL, 50, 0, 100000000, 0);
 
+static MYSQL_THDVAR_UINT(parallel_read_threads, PLUGIN_VAR_RQCMDARG,
+  "Number of threads for counting the rows of a table in SELECT COUNT(*)"
+  " without a WHERE clause (0=use a regular table scan).",
+  NULL, NULL, 0, 0, 256, 0);
+
 static MYSQL_THDVAR_STR(ft_user_stopword_table,
   PLUGIN_VAR_OPCMDARG|PLUGIN_VAR_MEMALLOC,
   "User supplied stopword table name, effective in the session level.",
@@ -959,6 +981,10 @@ static SHOW_VAR innodb_status_variables[]= {
   {"buffer_pool_read_ahead", &buf_pool.stat.n_ra_pages_read, SHOW_SIZE_T},
   {"buffer_pool_read_ahead_evicted",
    &buf_pool.stat.n_ra_pages_evicted, SHOW_SIZE_T},
+  {"buffer_pool_read_ahead_scan",
+   &buf_pool.stat.n_ra_pages_read_scan, SHOW_SIZE_T},
+  {"buffer_pool_read_ahead_scan_hits",
+   &buf_pool.stat.n_ra_scan_hits, SHOW_SIZE_T},
   {"buffer_pool_read_requests",
    &export_vars.innodb_buffer_pool_read_requests, SHOW_SIZE_T},
   {"buffer_pool_reads", &buf_pool.stat.n_pages_read, SHOW_SIZE_T},
@@ -975,6 +1001,8 @@ static SHOW_VAR innodb_status_variables[]= {
   {"data_reads", &export_vars.innodb_data_reads, SHOW_SIZE_T},
   {"data_writes", &export_vars.innodb_data_writes, SHOW_SIZE_T},
   {"data_written", &export_vars.innodb_data_written, SHOW_SIZE_T},
+  {"dblwr_pages_bypassed", &export_vars.innodb_dblwr_pages_bypassed,
+   SHOW_SIZE_T},
   {"dblwr_pages_written", &export_vars.innodb_dblwr_pages_written,SHOW_SIZE_T},
   {"dblwr_writes", &export_vars.innodb_dblwr_writes, SHOW_SIZE_T},
   {"deadlocks", &lock_sys.deadlocks, SHOW_SIZE_T},
@@ -1017,6 +1045,7 @@ static SHOW_VAR innodb_status_variables[]= {
   {"pages_created", &buf_pool.stat.n_pages_created, SHOW_SIZE_T},
   {"pages_read", &buf_pool.stat.n_pages_read, SHOW_SIZE_T},
   {"pages_written", &buf_pool.stat.n_pages_written, SHOW_SIZE_T},
+  {"parallel_count_scans", &row_count_n_scans, SHOW_SIZE_T},
   {"row_lock_current_waits", &export_vars.innodb_row_lock_current_waits,
    SHOW_SIZE_T},
   {"row_lock_time", &export_vars.innodb_row_lock_time, SHOW_LONGLONG},
@@ -3158,7 +3187,8 @@ ha_innobase::ha_innobase(
 			  |  (srv_force_primary_key ? HA_REQUIRE_PRIMARY_KEY : 0)
 		  ),
 	m_start_of_scan(),
-        m_mysql_has_locked()
+        m_mysql_has_locked(),
+	m_count_records()
 {}
 
 /*********************************************************************//**
@@ -5111,6 +5141,10 @@ ha_innobase::table_flags() const
 	/* Need to use tx_isolation here since table flags is (also)
 	called before prebuilt is inited. */
 
+	if (THDVAR(thd, parallel_read_threads)) {
+		flags |= HA_HAS_RECORDS;
+	}
+
 	if (thd_tx_isolation(thd) <= ISO_READ_COMMITTED) {
 		return(flags);
 	}
@@ -14561,6 +14595,63 @@ ha_innobase::estimate_rows_upper_bound()
 	DBUG_RETURN((ha_rows) estimate);
 }
 
+/** Request an exact row count from the following records() call.
+This is only invoked when table_flags() includes HA_HAS_RECORDS,
+for computing COUNT(*) without a WHERE clause.
+@return 0 */
+int ha_innobase::pre_records()
+{
+	m_count_records = true;
+	return 0;
+}
+
+/** Count the rows for SELECT COUNT(*) by scanning the clustered index
+in innodb_parallel_read_threads concurrent key ranges, if pre_records()
+was invoked. The optimizer also invokes records() for a cost estimate,
+which is stats.records as in handler::records().
+@return number of rows visible in the read view, or the estimate
+@retval HA_POS_ERROR if the rows must be counted by a regular scan */
+ha_rows ha_innobase::records()
+{
+	DBUG_ENTER("ha_innobase::records");
+
+	if (!m_count_records) {
+		DBUG_RETURN(handler::records());
+	}
+
+	m_count_records = false;
+
+	const uint n_threads = THDVAR(m_user_thd, parallel_read_threads);
+
+	if (!n_threads
+	    || srv_read_only_mode
+	    || m_prebuilt->select_lock_type != LOCK_NONE
+	    || m_prebuilt->table->no_rollback()
+	    || !m_prebuilt->table->space
+	    || !m_prebuilt->table->is_readable()
+	    || dict_table_get_first_index(m_prebuilt->table)
+	    ->is_corrupted()) {
+		DBUG_RETURN(HA_POS_ERROR);
+	}
+
+	trx_t*	trx = m_prebuilt->trx;
+
+	trx->op_info = "counting rows";
+
+	if (m_prebuilt->sql_stat_start) {
+		m_prebuilt->sql_stat_start = FALSE;
+		trx_start_if_not_started(trx, false);
+		trx->read_view.open(trx);
+	}
+
+	ulint	n_rows;
+	dberr_t	err = row_count_clust_recs(m_prebuilt, n_threads, &n_rows);
+
+	trx->op_info = "";
+
+	DBUG_RETURN(err == DB_SUCCESS ? ha_rows(n_rows) : HA_POS_ERROR);
+}
+
 /*********************************************************************//**
 How many seeks it will take to read through the table. This is to be
 comparable to the number returned by records_in_range so that we can
@@ -19334,6 +19425,15 @@ static MYSQL_SYSVAR_ENUM(deadlock_report, innodb_deadlock_report,
   "How to report deadlocks (if innodb_deadlock_detect=ON).",
   NULL, NULL, Deadlock::REPORT_FULL, &innodb_deadlock_report_typelib);
 
+static MYSQL_SYSVAR_ENUM(lock_schedule_algorithm,
+  innodb_lock_schedule_algorithm,
+  PLUGIN_VAR_RQCMDARG,
+  "The order in which waiting record locks are granted when a lock is"
+  " released: fcfs (in the order of the requests) or cats (first to the"
+  " transactions that block the most other transactions, unless a request"
+  " has waited for more than a second)",
+  NULL, NULL, LOCK_SCHEDULE_FCFS, &innodb_lock_schedule_algorithm_typelib);
+
 static MYSQL_SYSVAR_UINT(fill_factor, innobase_fill_factor,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of B-tree page filled during bulk insert",
@@ -19600,6 +19700,15 @@ static MYSQL_SYSVAR_BOOL(use_native_aio, srv_use_native_aio,
   "Use native AIO if supported on this platform.",
   NULL, NULL, innodb_use_native_aio_default());
 
+#ifdef HAVE_URING
+static MYSQL_SYSVAR_BOOL(use_native_aio_register, srv_use_native_aio_register,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Register the buffer pool and the data files with io_uring,"
+  " to reduce the per-request overhead of asynchronous I/O."
+  " The buffer pool will count against the memory locked limit.",
+  NULL, NULL, FALSE);
+#endif
+
 #ifdef HAVE_LIBNUMA
 static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
@@ -19670,6 +19779,12 @@ static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   " trigger a readahead.",
   NULL, NULL, 56, 0, 64, 0);
 
+static MYSQL_SYSVAR_ULONG(scan_read_ahead_pages, srv_scan_read_ahead_pages,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of index leaf pages that a forward range scan reads ahead"
+  " asynchronously (0=disable)",
+  NULL, NULL, 0, 0, 64, 0);
+
 static MYSQL_SYSVAR_STR(monitor_enable, innobase_enable_monitor_counter,
   PLUGIN_VAR_RQCMDARG,
   "Turn on a monitor counter",
@@ -19932,8 +20047,10 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(ft_num_word_optimize),
   MYSQL_SYSVAR(ft_sort_pll_degree),
   MYSQL_SYSVAR(lock_wait_timeout),
+  MYSQL_SYSVAR(parallel_read_threads),
   MYSQL_SYSVAR(deadlock_detect),
   MYSQL_SYSVAR(deadlock_report),
+  MYSQL_SYSVAR(lock_schedule_algorithm),
   MYSQL_SYSVAR(page_size),
   MYSQL_SYSVAR(log_buffer_size),
   MYSQL_SYSVAR(log_file_size),
@@ -19983,6 +20100,9 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(autoinc_lock_mode),
   MYSQL_SYSVAR(version),
   MYSQL_SYSVAR(use_native_aio),
+#ifdef HAVE_URING
+  MYSQL_SYSVAR(use_native_aio_register),
+#endif
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
 #endif /* HAVE_LIBNUMA */
@@ -19994,6 +20114,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
 #endif /* UNIV_DEBUG || UNIV_IBUF_DEBUG */
   MYSQL_SYSVAR(random_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
+  MYSQL_SYSVAR(scan_read_ahead_pages),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
   MYSQL_SYSVAR(instant_alter_column_allowed),
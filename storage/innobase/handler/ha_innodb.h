@@ -188,6 +188,10 @@ class ha_innobase final : public handler
 
 	ha_rows estimate_rows_upper_bound() override;
 
+	int pre_records() override;
+
+	ha_rows records() override;
+
 	void update_create_info(HA_CREATE_INFO* create_info) override;
 
 	int create(
@@ -533,6 +537,10 @@ class ha_innobase final : public handler
 
         /** If mysql has locked with external_lock() */
         bool                    m_mysql_has_locked;
+
+	/** whether pre_records() requested an exact count from the
+	next records() call */
+	bool			m_count_records;
 };
 
 
@@ -198,6 +198,16 @@ struct btr_search_t{
 				which would have succeeded, or did succeed,
 				using the hash index;
 				the range is 0 .. BTR_SEARCH_BUILD_LIMIT + 5 */
+	ulint	n_hash_hits;	/*!< number of searches that were, or
+				could have been, answered by the hash index;
+				halved on each btr_search_check_throttle() */
+	ulint	n_hash_updates;	/*!< number of hash index updates caused by
+				records being inserted or deleted; halved
+				on each btr_search_check_throttle() */
+	bool	throttled;	/*!< true if maintaining the hash index costs
+				more than it saves, so that the hash index
+				is not built on the pages of this index, and
+				it is dropped from pages that are modified */
 	/* @} */
 	ulint	ref_count;	/*!< Number of blocks in this index tree
 				that have search index built
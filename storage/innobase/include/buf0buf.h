@@ -1171,6 +1171,12 @@ struct buf_pool_stat_t{
 	ulint	n_ra_pages_evicted;/*!< number of read ahead
 				pages that are evicted without
 				being accessed */
+	ulint	n_ra_pages_read_scan;/*!< number of pages read in
+				by buf_read_ahead_scan() */
+	ulint	n_ra_scan_hits;	/*!< number of times a range scan
+				moved to a leaf page that had been
+				read ahead and not yet accessed;
+				NOT protected by buf_pool.mutex */
 	ulint	n_pages_made_young; /*!< number of pages made young, in
 				buf_page_make_young() */
 	ulint	n_pages_not_made_young; /*!< number of pages not made
@@ -1292,6 +1298,13 @@ class buf_pool_t
   /** Clean up after successful create() */
   void close() noexcept;
 
+#ifdef HAVE_URING
+  /** Register the chunks with io_uring if innodb_use_native_aio_register */
+  void io_register() noexcept;
+  /** Unregister the chunks from io_uring */
+  void io_unregister() noexcept;
+#endif
+
   /** Resize from srv_buf_pool_old_size to srv_buf_pool_size. */
   inline void resize();
 
@@ -97,6 +97,22 @@ which could result in a deadlock if the OS does not support asynchronous io.
 ulint
 buf_read_ahead_linear(const page_id_t page_id, bool ibuf) noexcept;
 
+/** Read ahead the index leaf pages that a forward range scan is about
+to visit, up to innodb_scan_read_ahead_pages pages past the page that
+the scan just moved to. The FIL_PAGE_NEXT chain is followed through the
+pages that are in the buffer pool. The successor of a page that is not
+in the buffer pool is unknown until the page has been read; if the
+pages so far were physically consecutive, the next page numbers are
+assumed to continue that pattern.
+NOTE: the calling thread may own latches on pages; like
+buf_read_ahead_linear(), this function does not latch any pages, and
+it may read stale FIL_PAGE_NEXT values, which only results in a
+useless read.
+@param page_id  the leaf page that the scan just moved to
+@param next     the FIL_PAGE_NEXT of page_id
+@return number of page read requests issued */
+ulint buf_read_ahead_scan(const page_id_t page_id, uint32_t next) noexcept;
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
@@ -1129,6 +1129,9 @@ struct fil_node_t final
   /** whether the tablespace discovery is being deferred during crash
   recovery due to incompletely written page 0 */
   unsigned deferred:1;
+  /** flags that page writes must be submitted with for atomic_write
+  (RWF_ATOMIC), or 0 */
+  int atomic_write_flags;
 
   /** size of the file in database pages (0 if not known yet);
   the possible last incomplete megabyte may be ignored if space->id == 0 */
@@ -45,6 +45,18 @@ class ReadView;
 extern my_bool innodb_deadlock_detect;
 /** The value of innodb_deadlock_report */
 extern ulong innodb_deadlock_report;
+/** The value of innodb_lock_schedule_algorithm */
+extern ulong innodb_lock_schedule_algorithm;
+
+/** The allowed values of innodb_lock_schedule_algorithm */
+enum lock_schedule_algorithm
+{
+  /** grant waiting record locks in the order of the requests */
+  LOCK_SCHEDULE_FCFS,
+  /** grant waiting record locks first to the transactions that block
+  the most other transactions, unless a request has waited for long */
+  LOCK_SCHEDULE_CATS
+};
 
 namespace Deadlock
 {
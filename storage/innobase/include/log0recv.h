@@ -297,6 +297,11 @@ struct recv_sys_t
 				record, or 0 if none was parsed */
 	/** the time when progress was last reported */
 	time_t		progress_time;
+	/** number of pages that log was applied to in the current apply()
+	batch; incremented by the I/O completion threads */
+	Atomic_counter<size_t> n_pages_applied;
+	/** my_interval_timer() at the start of the current apply() batch */
+	ulonglong	apply_start_time;
 
   using map = std::map<const page_id_t, page_recv_t,
                        std::less<const page_id_t>,
@@ -448,6 +453,8 @@ struct recv_sys_t
   ATTRIBUTE_COLD void rewind(const byte *end, const byte *begin) noexcept;
   /** Report progress in terms of LSN or pages remaining */
   ATTRIBUTE_COLD void report_progress() const;
+  /** Report the number of applied pages and the throughput of apply() */
+  ATTRIBUTE_COLD void report_apply_rate(bool last) const;
 public:
   /** Determine whether redo log recovery progress should be reported.
   @param time  the current time
@@ -270,6 +270,9 @@ constexpr ulint OS_AIO_N_PENDING_IOS_PER_THREAD= 256;
 
 extern Atomic_counter<ulint> os_n_file_reads;
 extern Atomic_counter<size_t> os_n_file_writes;
+/** Number of page writes that were submitted with
+fil_node_t::atomic_write_flags instead of via the doublewrite buffer */
+extern Atomic_counter<size_t> os_n_atomic_page_writes;
 extern Atomic_counter<size_t> os_n_fsyncs;
 
 /* File types for directory entry data type */
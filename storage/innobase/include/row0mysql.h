@@ -452,6 +452,10 @@ struct mysql_row_templ_t {
 #define MYSQL_FETCH_CACHE_SIZE		8
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
+/* A long scan doubles the fetch_cache batch up to this many rows */
+#define MYSQL_FETCH_CACHE_MAX_SIZE	64
+/* Memory limit for fetch_cache batches beyond MYSQL_FETCH_CACHE_SIZE */
+#define MYSQL_FETCH_CACHE_MAX_BYTES	65536
 
 #define ROW_PREBUILT_ALLOCATED	78540783
 #define ROW_PREBUILT_FREED	26423527
@@ -625,7 +629,7 @@ struct row_prebuilt_t {
 	ulint		n_rows_fetched;	/*!< number of rows fetched after
 					positioning the current cursor */
 	ulint		fetch_direction;/*!< ROW_SEL_NEXT or ROW_SEL_PREV */
-	byte*		fetch_cache[MYSQL_FETCH_CACHE_SIZE];
+	byte*		fetch_cache[MYSQL_FETCH_CACHE_MAX_SIZE];
 					/*!< a cache for fetched rows if we
 					fetch many rows from the same cursor:
 					it saves CPU time to fetch them in a
@@ -643,6 +647,13 @@ struct row_prebuilt_t {
 					fetched row in fetch_cache */
 	ulint		n_fetch_cached;	/*!< number of not yet fetched rows
 					in fetch_cache */
+	ulint		fetch_cache_size;/*!< number of rows to fetch into
+					fetch_cache in one batch; starts at
+					MYSQL_FETCH_CACHE_SIZE when the cursor
+					is positioned and grows while the scan
+					keeps going in the same direction */
+	ulint		fetch_cache_alloc;/*!< number of allocated rows
+					in fetch_cache, or 0 */
 	mem_heap_t*	blob_heap;	/*!< in SELECTS BLOB fields are copied
 					to this heap */
 	mem_heap_t*	old_vers_heap;	/*!< memory heap where a previous
@@ -178,6 +178,21 @@ current read view.
 dberr_t row_check_index(row_prebuilt_t *prebuilt, ulint *n_rows)
   MY_ATTRIBUTE((nonnull, warn_unused_result));
 
+/** Count the records of the clustered index that are visible in the
+read view of the transaction (SELECT COUNT(*) without a WHERE clause).
+The key space is split at the node pointers of the root page, and the
+resulting key ranges are scanned concurrently in srv_thread_pool.
+@param prebuilt   table handle and transaction
+@param n_threads  maximum number of key ranges to scan concurrently
+@param n_rows     number of records counted
+@return error code */
+dberr_t row_count_clust_recs(row_prebuilt_t *prebuilt, ulint n_threads,
+                             ulint *n_rows)
+  MY_ATTRIBUTE((nonnull, warn_unused_result));
+
+/** Number of row_count_clust_recs() calls (Innodb_parallel_count_scans) */
+extern Atomic_counter<ulint> row_count_n_scans;
+
 /** Read the max AUTOINC value from an index.
 @param[in] index	index starting with an AUTO_INCREMENT column
 @return	the largest AUTO_INCREMENT value
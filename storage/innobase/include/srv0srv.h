@@ -231,6 +231,11 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio.
 Currently we support native aio on windows and linux */
 extern my_bool	srv_use_native_aio;
+#ifdef HAVE_URING
+/** innodb_use_native_aio_register: whether to register the buffer pool
+and the data files with io_uring */
+extern my_bool	srv_use_native_aio_register;
+#endif
 extern my_bool	srv_numa_interleave;
 
 /* Use atomic writes i.e disable doublewrite buffer */
@@ -306,6 +311,7 @@ extern ulint	srv_lock_table_size;
 extern ulong	srv_checksum_algorithm;
 extern my_bool	srv_random_read_ahead;
 extern ulong	srv_read_ahead_threshold;
+extern ulong	srv_scan_read_ahead_pages;
 extern uint	srv_n_read_io_threads;
 extern uint	srv_n_write_io_threads;
 
@@ -672,6 +678,7 @@ struct export_var_t{
 	ulint innodb_data_writes;		/*!< I/O write requests */
 	ulint innodb_data_written;		/*!< Data bytes written */
 	ulint innodb_data_reads;		/*!< I/O read requests */
+	ulint innodb_dblwr_pages_bypassed;	/*!< os_n_atomic_page_writes */
 	ulint innodb_dblwr_pages_written;	/*!< srv_dblwr_pages_written */
 	ulint innodb_dblwr_writes;		/*!< srv_dblwr_writes */
 	ulint innodb_history_list_length;
@@ -312,6 +312,9 @@ struct trx_lock_t
   Atomic_relaxed<lock_t*> wait_lock;
   /** Transaction being waited for; protected by lock_sys.wait_mutex */
   trx_t *wait_trx;
+  /** Number of transactions whose wait_trx points to this transaction;
+  the scheduling weight for innodb_lock_schedule_algorithm=cats */
+  Atomic_relaxed<uint32_t> n_blocked;
   /** condition variable for !wait_lock; used with lock_sys.wait_mutex */
   pthread_cond_t cond;
   /** lock wait start time */
@@ -60,6 +60,8 @@ Created 5/7/1996 Heikki Tuuri
 my_bool innodb_deadlock_detect;
 /** The value of innodb_deadlock_report */
 ulong innodb_deadlock_report;
+/** The value of innodb_lock_schedule_algorithm */
+ulong innodb_lock_schedule_algorithm;
 
 #if defined(UNIV_DEBUG) || \
     defined(INNODB_ENABLE_XAP_UNLOCK_UNMODIFIED_FOR_PRIMARY)
@@ -1295,6 +1297,21 @@ lock_number_of_tables_locked(
 
 /*============== RECORD LOCK CREATION AND QUEUE MANAGEMENT =============*/
 
+/** Set the transaction that a transaction is waiting for.
+@param trx       waiting transaction
+@param wait_trx  transaction that holds a conflicting lock, or nullptr */
+static void lock_set_wait_trx(trx_t *trx, trx_t *wait_trx)
+{
+  if (trx_t *old= trx->lock.wait_trx)
+  {
+    ut_ad(old->lock.n_blocked);
+    old->lock.n_blocked.fetch_sub(1);
+  }
+  if (wait_trx)
+    wait_trx->lock.n_blocked.fetch_add(1);
+  trx->lock.wait_trx= wait_trx;
+}
+
 /** Reset the wait status of a lock.
 @param[in,out]	lock	lock that was possibly being waited for */
 static void lock_reset_lock_and_trx_wait(lock_t *lock)
@@ -1307,7 +1324,7 @@ static void lock_reset_lock_and_trx_wait(lock_t *lock)
   if (trx_t *wait_trx= trx->lock.wait_trx)
     Deadlock::to_check.erase(wait_trx);
   trx->lock.wait_lock= nullptr;
-  trx->lock.wait_trx= nullptr;
+  lock_set_wait_trx(trx, nullptr);
   lock->type_mode&= ~LOCK_WAIT;
 }
 
@@ -1441,8 +1458,12 @@ lock_rec_create_low(
 			ut_ad((*trx->lock.wait_lock).trx == trx);
 		} else {
 			ut_ad(c_lock);
-			trx->lock.wait_trx = c_lock->trx;
+			lock_set_wait_trx(trx, c_lock->trx);
 			ut_ad(!trx->lock.wait_lock);
+			/* lock_wait() will set this again, but
+			lock_rec_grant_by_weight() may look at it
+			before that. */
+			trx->lock.suspend_time = my_hrtime_coarse();
 		}
 		trx->lock.wait_lock = lock;
 	}
@@ -2341,6 +2362,93 @@ static void lock_rec_cancel(lock_t *lock)
   trx->mutex_unlock();
 }
 
+/** Check if a waiting record lock request conflicts with a granted lock.
+@param cell       hash table cell
+@param wait_lock  waiting lock request
+@return a conflicting granted lock
+@retval nullptr if the request could be granted ahead of other waiting
+requests */
+static const lock_t *lock_rec_has_to_wait_granted(const hash_cell_t &cell,
+                                                  const lock_t *wait_lock)
+{
+  ut_ad(wait_lock->is_waiting());
+  ut_ad(!wait_lock->is_table());
+
+  const ulint heap_no= lock_rec_find_set_bit(wait_lock);
+  const ulint bit_offset= heap_no / 8;
+  const ulint bit_mask= ulint{1} << (heap_no % 8);
+
+  for (const lock_t *lock=
+         lock_sys_t::get_first(cell, wait_lock->un_member.rec_lock.page_id);
+       lock; lock= lock_rec_get_next_on_page_const(lock))
+  {
+    const byte *p= reinterpret_cast<const byte*>(&lock[1]);
+    if (lock != wait_lock && !lock->is_waiting() &&
+        heap_no < lock_rec_get_n_bits(lock) && (p[bit_offset] & bit_mask) &&
+        lock_has_to_wait(wait_lock, lock))
+      return lock;
+  }
+
+  return nullptr;
+}
+
+/** Grant the waiting record lock requests on a page that only conflict
+with other waiting requests, starting with the transactions that block
+the most other transactions (Contention-Aware Transaction Scheduling).
+The remaining requests must be processed in the queue order afterwards.
+Once any request on the page has waited for longer than
+LOCK_SCHEDULE_MAX_BYPASS, or belongs to a Galera transaction,
+no request is granted out of order.
+@param cell  hash table cell
+@param id    page identifier */
+static void lock_rec_grant_by_weight(hash_cell_t &cell, const page_id_t id)
+{
+  lock_sys.assert_locked(cell);
+  mysql_mutex_assert_owner(&lock_sys.wait_mutex);
+  /** How long a request may be bypassed by later requests, in microseconds */
+  static constexpr ulonglong LOCK_SCHEDULE_MAX_BYPASS= 1000000;
+
+  /* (weight << 32 | ~position, waiting request) */
+  small_vector<std::pair<uint64_t, lock_t*>, 16> waiting;
+  const ulonglong now= my_hrtime_coarse().val;
+  uint32_t pos= 0;
+
+  for (lock_t *lock= lock_sys_t::get_first(cell, id); lock;
+       lock= lock_rec_get_next_on_page(lock), pos++)
+  {
+    if (!lock->is_waiting())
+      continue;
+    const trx_t *trx= lock->trx;
+    /* Galera conflict resolution assumes the queue order. */
+    if (trx->is_wsrep())
+      return;
+    const my_hrtime_t suspend_time= trx->lock.suspend_time;
+    if (now > suspend_time.val &&
+        now - suspend_time.val >= LOCK_SCHEDULE_MAX_BYPASS &&
+        DBUG_EVALUATE_IF("lock_schedule_unbounded", false, true))
+      return;
+    waiting.emplace_back(std::pair<uint64_t, lock_t*>
+                         {uint64_t{trx->lock.n_blocked} << 32 | ~pos, lock});
+  }
+
+  std::sort(waiting.begin(), waiting.end(),
+            [](const std::pair<uint64_t, lock_t*> &a,
+               const std::pair<uint64_t, lock_t*> &b)
+            { return a.first > b.first; });
+
+  for (const auto &w : waiting)
+  {
+    lock_t *lock= w.second;
+    if (lock_rec_has_to_wait_granted(cell, lock))
+      continue;
+    lock_grant(lock);
+    /* Granted locks must not be preceded by waiting requests. */
+    cell.remove(*lock, &lock_t::hash);
+    lock->hash= static_cast<lock_t*>(cell.node);
+    cell.node= lock;
+  }
+}
+
 /** Remove a record lock request, waiting or granted, from the queue and
 grant locks to other transactions in the queue if they now are entitled
 to a lock. NOTE: all record locks contained in in_lock are removed.
@@ -2371,6 +2479,10 @@ static void lock_rec_dequeue_from_page(lock_t *in_lock, bool owns_wait_mutex)
 	MONITOR_DEC(MONITOR_NUM_RECLOCK);
 
 	bool acquired = false;
+	/* Whether to grant locks out of order first */
+	bool cats = innodb_lock_schedule_algorithm == LOCK_SCHEDULE_CATS
+		&& !(in_lock->type_mode & (LOCK_PREDICATE | LOCK_PRDT_PAGE))
+		&& !in_lock->trx->is_wsrep();
 
 	/* Check if waiting locks in the queue can now be granted:
 	grant locks if there are no conflicting locks ahead. Stop at
@@ -2389,13 +2501,21 @@ static void lock_rec_dequeue_from_page(lock_t *in_lock, bool owns_wait_mutex)
 			acquired = owns_wait_mutex = true;
 		}
 
+		if (cats) {
+			cats = false;
+			lock_rec_grant_by_weight(cell, page_id);
+			if (!lock->is_waiting()) {
+				continue;
+			}
+		}
+
 		ut_ad(lock->trx->lock.wait_trx);
 		ut_ad(lock->trx->lock.wait_lock);
 
 		if (const lock_t* c = lock_rec_has_to_wait_in_queue(
 			    cell, lock)) {
 			trx_t* c_trx = c->trx;
-			lock->trx->lock.wait_trx = c_trx;
+			lock_set_wait_trx(lock->trx, c_trx);
 			if (c_trx->lock.wait_trx
 			    && innodb_deadlock_detect
 			    && Deadlock::to_check.emplace(c_trx).second) {
@@ -3682,7 +3802,7 @@ lock_t *lock_table_create(dict_table_t *table, unsigned type_mode, trx_t *trx,
 			ut_ad((*trx->lock.wait_lock).trx == trx);
 		} else {
 			ut_ad(c_lock);
-			trx->lock.wait_trx = c_lock->trx;
+			lock_set_wait_trx(trx, c_lock->trx);
 			ut_ad(!trx->lock.wait_lock);
 		}
 		trx->lock.wait_lock = lock;
@@ -4047,7 +4167,7 @@ static void lock_table_dequeue(lock_t *in_lock, bool owns_wait_mutex)
 
 		if (const lock_t* c = lock_table_has_to_wait_in_queue(lock)) {
 			trx_t* c_trx = c->trx;
-			lock->trx->lock.wait_trx = c_trx;
+			lock_set_wait_trx(lock->trx, c_trx);
 			if (c_trx->lock.wait_trx
 			    && innodb_deadlock_detect
 			    && Deadlock::to_check.emplace(c_trx).second) {
@@ -4223,7 +4343,7 @@ static void lock_rec_rebuild_waiting_queue(
     ut_ad(lock->trx->lock.wait_lock);
 
     if (const lock_t *c= lock_rec_has_to_wait_in_queue(cell, lock))
-      lock->trx->lock.wait_trx= c->trx;
+      lock_set_wait_trx(lock->trx, c->trx);
     else
     {
       /* Grant the lock */
@@ -1465,6 +1465,8 @@ void recv_sys_t::create()
 	mlog_checkpoint_lsn = 0;
 
 	progress_time = time(NULL);
+	n_pages_applied = 0;
+	apply_start_time = 0;
 	ut_ad(pages.empty());
 	pages_it = pages.end();
 
@@ -3155,6 +3157,7 @@ static buf_block_t *recv_recover_page(buf_block_t *block, mtr_t &mtr,
 	mtr.discard_modifications();
 	mtr.commit();
 
+	recv_sys.n_pages_applied++;
 	return block;
 }
 
@@ -3333,6 +3336,21 @@ void recv_sys_t::report_progress() const
                                    recv_sys.recovered_lsn,
                                    recv_sys.scanned_lsn, n);
   }
+  if (apply_log_recs && n_pages_applied)
+    report_apply_rate(false);
+}
+
+ATTRIBUTE_COLD
+void recv_sys_t::report_apply_rate(bool last) const
+{
+  const size_t n{n_pages_applied};
+  const ulonglong elapsed_ms= (my_interval_timer() - apply_start_time) /
+    1000000;
+  const size_t rate= elapsed_ms ? size_t(n * 1000 / elapsed_ms) : n;
+  sql_print_information("InnoDB: %s log to %zu pages in %llu.%03llu"
+                        " seconds (%zu pages/s)",
+                        last ? "Applied" : "Applying",
+                        n, elapsed_ms / 1000, elapsed_ms % 1000, rate);
 }
 
 /** Apply a recovery batch.
@@ -3716,6 +3734,8 @@ void recv_sys_t::apply(bool last_batch)
       srv_operation == SRV_OPERATION_RESTORE ||
       srv_operation == SRV_OPERATION_RESTORE_EXPORT;
     progress_time= time(nullptr);
+    n_pages_applied= 0;
+    apply_start_time= my_interval_timer();
     report_progress();
 
     apply_log_recs= true;
@@ -3768,6 +3788,8 @@ void recv_sys_t::apply(bool last_batch)
       }
     }
 
+    report_apply_rate(true);
+
     if (space)
       space->release();
 
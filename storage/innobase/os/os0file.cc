@@ -56,6 +56,10 @@ Created 10/21/1995 Heikki Tuuri
 #include <libaio.h>
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef TPOOL_HAVE_RW_FLAGS
+# include <sys/uio.h> /* pwritev2() */
+#endif
+
 #ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
 # include <fcntl.h>
 # include <linux/falloc.h>
@@ -146,6 +150,7 @@ constexpr ulint NUM_RETRIES_ON_PARTIAL_IO = 10;
 Atomic_counter<ulint> os_n_file_reads;
 static ulint	os_bytes_read_since_printout;
 Atomic_counter<size_t> os_n_file_writes;
+Atomic_counter<size_t> os_n_atomic_page_writes;
 Atomic_counter<size_t> os_n_fsyncs;
 static ulint	os_n_file_reads_old;
 static ulint	os_n_file_writes_old;
@@ -308,6 +313,26 @@ class SyncFileIO
   os_offset_t m_offset;
 };
 
+/** Determine the flags that a write must be submitted with.
+Only writes of a complete, aligned page can be requested to be atomic;
+other writes need not be. The caller must submit the write with the
+returned flags, because it is counted in os_n_atomic_page_writes.
+@param type    I/O request
+@param n       number of bytes to write
+@param offset  file offset
+@return the fil_node_t::atomic_write_flags (RWF_ATOMIC), or 0 */
+static int os_file_rw_flags(const IORequest &type, size_t n,
+                            os_offset_t offset) noexcept
+{
+  if (!type.is_write() || !type.node || !type.node->atomic_write_flags)
+    return 0;
+  const size_t physical_size= type.node->space->physical_size();
+  if (n != physical_size || offset % physical_size)
+    return 0;
+  ++os_n_atomic_page_writes;
+  return type.node->atomic_write_flags;
+}
+
 #ifndef _WIN32 /* On Microsoft Windows, mandatory locking is used */
 /** Obtain an exclusive lock on a file.
 @param fd      file descriptor
@@ -647,6 +672,14 @@ SyncFileIO::execute(const IORequest& request)
 #ifdef _WIN32
 		n_bytes = tpool::pwrite(m_fh, m_buf, m_n, m_offset);
 #else
+# ifdef TPOOL_HAVE_RW_FLAGS
+		if (int flags = os_file_rw_flags(request, size_t(m_n),
+						     m_offset)) {
+			iovec iov{m_buf, size_t(m_n)};
+			n_bytes = pwritev2(m_fh, &iov, 1, m_offset, flags);
+			return(n_bytes);
+		}
+# endif
 		n_bytes = pwrite(m_fh, m_buf, m_n, m_offset);
 #endif
 	}
@@ -1204,6 +1237,16 @@ os_file_create_func(
 	}
 #endif /* !_WIN32 */
 
+#ifdef HAVE_URING
+	/* Register data files as io_uring fixed files.
+	os_file_close_func() will unregister them. */
+	if (*success && type != OS_LOG_FILE
+	    && srv_use_native_aio && srv_use_native_aio_register
+	    && srv_thread_pool) {
+		srv_thread_pool->bind(file);
+	}
+#endif
+
 	return(file);
 }
 
@@ -1388,6 +1431,12 @@ os_file_get_last_error.
 @return true if success */
 bool os_file_close_func(os_file_t file)
 {
+#ifdef HAVE_URING
+  /* The fixed file slot must be released before the file descriptor
+  can be reused. */
+  if (srv_use_native_aio_register && srv_thread_pool)
+    srv_thread_pool->unbind(file);
+#endif
   int ret= close(file);
 
   if (!ret)
@@ -3589,6 +3638,7 @@ dberr_t os_aio(const IORequest &type, void *buf, os_offset_t offset, size_t n)
 	cb->m_len = (int)n;
 	cb->m_offset = offset;
 	cb->m_opcode = opcode;
+	cb->m_rw_flags = os_file_rw_flags(type, n, offset);
 	new (cb->m_userdata) IORequest{type};
 
 	ut_a(reinterpret_cast<size_t>(cb->m_buffer) % OS_FILE_LOG_BLOCK_SIZE
@@ -3832,6 +3882,7 @@ void fil_node_t::find_metadata(IF_WIN(,bool create)) noexcept
 {
   ut_ad(is_open());
   os_file_t file= handle;
+  atomic_write_flags= 0;
 
   if (!space->is_compressed())
     punch_hole= 0;
@@ -3878,6 +3929,16 @@ void fil_node_t::find_metadata(IF_WIN(,bool create)) noexcept
   atomic_write= srv_use_atomic_writes &&
     IF_WIN(srv_page_size == block_size,
            my_test_if_atomic_write(file, space->physical_size()));
+#ifndef _WIN32
+  /* Storage that only guarantees untorn writes when they are
+  requested (RWF_ATOMIC) cannot cover page_compressed tables,
+  because their pages are written with a variable length. */
+  if (!atomic_write && srv_use_atomic_writes && !space->is_compressed())
+  {
+    atomic_write_flags= my_atomic_write_flags(file, space->physical_size());
+    atomic_write= atomic_write_flags != 0;
+  }
+#endif
 }
 
 /** Read the first page of a data file.
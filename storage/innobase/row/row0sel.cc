@@ -3878,11 +3878,19 @@ row_sel_prefetch_cache_init(
 	ulint	sz;
 	byte*	ptr;
 
+	/* Narrow rows may be fetched in larger batches during long scans,
+	as long as the cache stays within MYSQL_FETCH_CACHE_MAX_BYTES. */
+	prebuilt->fetch_cache_alloc = std::max<ulint>(
+		MYSQL_FETCH_CACHE_SIZE,
+		std::min<ulint>(MYSQL_FETCH_CACHE_MAX_SIZE,
+				MYSQL_FETCH_CACHE_MAX_BYTES
+				/ (prebuilt->mysql_row_len + 8)));
+
 	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	sz = prebuilt->fetch_cache_alloc * (prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < prebuilt->fetch_cache_alloc; i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3909,7 +3917,7 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_cache_size);
 
 	if (prebuilt->fetch_cache[0] == NULL) {
 		/* Allocate memory for the fetch cache */
@@ -4427,6 +4435,7 @@ row_search_mvcc(
 		prebuilt->n_rows_fetched = 0;
 		prebuilt->n_fetch_cached = 0;
 		prebuilt->fetch_cache_first = 0;
+		prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
 
 		if (prebuilt->sel_graph == NULL) {
 			/* Build a dummy select query graph */
@@ -4451,6 +4460,7 @@ row_search_mvcc(
 			prebuilt->n_rows_fetched = 0;
 			prebuilt->n_fetch_cached = 0;
 			prebuilt->fetch_cache_first = 0;
+			prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
 
 		} else if (UNIV_LIKELY(prebuilt->n_fetch_cached > 0)) {
 			row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
@@ -4461,7 +4471,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_cache_size) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -4470,6 +4481,26 @@ row_search_mvcc(
 			DBUG_RETURN(DB_RECORD_NOT_FOUND);
 		}
 
+		if (prebuilt->fetch_cache_size < prebuilt->fetch_cache_alloc
+		    && prebuilt->n_rows_fetched
+		    >= 2 * prebuilt->fetch_cache_size) {
+			/* The scan keeps going in the same direction:
+			fetch larger batches, so that the cost of
+			restoring the cursor position and of the
+			function call setup is spread over more rows. */
+			prebuilt->fetch_cache_size = std::min(
+				2 * prebuilt->fetch_cache_size,
+				prebuilt->fetch_cache_alloc);
+			DBUG_EXECUTE_IF(
+				"row_search_fetch_cache_grow",
+				push_warning_printf(
+					trx->mysql_thd,
+					Sql_condition::WARN_LEVEL_NOTE,
+					ER_UNKNOWN_ERROR,
+					"InnoDB: fetching %zu rows per batch",
+					size_t(prebuilt->fetch_cache_size)););
+		}
+
 #if SIZEOF_SIZE_T < 8
 		if (UNIV_LIKELY(~prebuilt->n_rows_fetched))
 #endif
@@ -5649,7 +5680,7 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_cache_size);
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5701,7 +5732,7 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_cache_size) {
 			goto next_rec;
 		}
 	} else {
@@ -6856,3 +6887,238 @@ dberr_t row_check_index(row_prebuilt_t *prebuilt, ulint *n_rows)
 
   goto rec_loop;
 }
+
+/** A key range of the clustered index that is counted by one task
+of row_count_clust_recs() */
+struct row_count_part_t
+{
+  /** table handle and transaction */
+  row_prebuilt_t *prebuilt;
+  /** the smallest key of the range, or nullptr for the start of the index */
+  const dtuple_t *low;
+  /** the smallest key beyond the range, or nullptr for the end of index */
+  const dtuple_t *high;
+  /** number of records counted */
+  ulint n_rows;
+  /** error code */
+  dberr_t err;
+};
+
+/** Count the records of a key range of the clustered index that are
+visible in the read view of the transaction.
+@param arg  row_count_part_t */
+static void row_count_clust_range(void *arg)
+{
+  row_count_part_t *part= static_cast<row_count_part_t*>(arg);
+  trx_t *const trx= part->prebuilt->trx;
+  dict_index_t *const index= dict_table_get_first_index(part->prebuilt->table);
+  const bool comp= index->table->not_redundant();
+  const bool mvcc= trx->isolation_level != TRX_ISO_READ_UNCOMMITTED &&
+    !index->table->is_temporary();
+
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs_init(offsets_);
+  rec_offs *offsets= offsets_;
+  mem_heap_t *heap= nullptr;
+  mem_heap_t *vers_heap= nullptr;
+  ulint n_rows= 0;
+
+  btr_pcur_t pcur;
+  mtr_t mtr;
+  mtr.start();
+  pcur.btr_cur.page_cur.index= index;
+  dberr_t err= part->low
+    ? btr_pcur_open_with_no_init(part->low, PAGE_CUR_GE, BTR_SEARCH_LEAF,
+                                 &pcur, &mtr)
+    : pcur.open_leaf(true, index, BTR_SEARCH_LEAF, &mtr);
+
+  /* The search positioned the cursor on the first record of the range,
+  while the loop below starts by advancing the cursor. */
+  if (err == DB_SUCCESS && !page_rec_is_infimum(btr_pcur_get_rec(&pcur)))
+    btr_pcur_move_to_prev_on_page(&pcur);
+
+  while (err == DB_SUCCESS)
+  {
+    if (!btr_pcur_move_to_next_on_page(&pcur))
+    {
+      err= DB_CORRUPTION;
+      break;
+    }
+
+    const rec_t *rec= btr_pcur_get_rec(&pcur);
+
+    if (page_rec_is_supremum(rec))
+    {
+      if (btr_pcur_is_after_last_in_tree(&pcur))
+        break;
+      err= btr_pcur_move_to_next_page(&pcur, &mtr);
+      if (err == DB_SUCCESS && trx_is_interrupted(trx))
+        err= DB_INTERRUPTED;
+      if (UNIV_LIKELY_NULL(heap))
+      {
+        offsets= offsets_;
+        mem_heap_empty(heap);
+      }
+      continue;
+    }
+
+    if (UNIV_UNLIKELY(rec_is_metadata(rec, *index)))
+      continue;
+
+    offsets= rec_get_offsets(rec, index, offsets, index->n_core_fields,
+                             ULINT_UNDEFINED, &heap);
+
+    if (part->high && cmp_dtuple_rec(part->high, rec, offsets) <= 0)
+      break;
+
+    if (mvcc)
+    {
+      const trx_id_t rec_trx_id= row_get_rec_trx_id(rec, index, offsets);
+
+      if (!trx->read_view.changes_visible(rec_trx_id))
+      {
+        if (rec_trx_id >= trx->read_view.low_limit_id() &&
+            UNIV_UNLIKELY(rec_trx_id >= trx_sys.get_max_trx_id()))
+        {
+          err= DB_CORRUPTION;
+          break;
+        }
+
+        if (vers_heap)
+          mem_heap_empty(vers_heap);
+        else
+          vers_heap= mem_heap_create(srv_page_size);
+
+        rec_t *old_vers;
+        err= row_vers_build_for_consistent_read(rec, &mtr, index, &offsets,
+                                                &trx->read_view, &heap,
+                                                vers_heap, &old_vers, nullptr);
+        if (err != DB_SUCCESS || !old_vers)
+          continue;
+        rec= old_vers;
+      }
+    }
+
+    if (!rec_get_deleted_flag(rec, comp))
+      n_rows++;
+  }
+
+  mtr.commit();
+  if (UNIV_LIKELY_NULL(heap))
+    mem_heap_free(heap);
+  if (vers_heap)
+    mem_heap_free(vers_heap);
+
+  part->n_rows= n_rows;
+  part->err= err;
+}
+
+/** Number of row_count_clust_recs() calls (Innodb_parallel_count_scans) */
+Atomic_counter<ulint> row_count_n_scans;
+
+/** Count the records of the clustered index that are visible in the
+read view of the transaction (SELECT COUNT(*) without a WHERE clause).
+The key space is split at the node pointers of the root page, and the
+resulting key ranges are scanned concurrently in srv_thread_pool.
+@param prebuilt   table handle and transaction
+@param n_threads  maximum number of key ranges to scan concurrently
+@param n_rows     number of records counted
+@return error code */
+dberr_t row_count_clust_recs(row_prebuilt_t *prebuilt, ulint n_threads,
+                             ulint *n_rows)
+{
+  dict_index_t *const index= dict_table_get_first_index(prebuilt->table);
+  trx_t *const trx= prebuilt->trx;
+
+  *n_rows= 0;
+  row_count_n_scans++;
+
+  if (trx->isolation_level != TRX_ISO_READ_UNCOMMITTED)
+    if (const trx_id_t bulk_trx_id= index->table->bulk_trx_id)
+      if (!trx->read_view.changes_visible(bulk_trx_id))
+        return DB_SUCCESS;
+
+  mem_heap_t *heap= mem_heap_create(srv_page_size);
+  std::vector<const dtuple_t*> bounds;
+  dberr_t err= DB_SUCCESS;
+
+  if (n_threads > 1)
+  {
+    mtr_t mtr;
+    mtr.start();
+
+    if (const buf_block_t *root= btr_root_block_get(index, RW_S_LATCH,
+                                                    &mtr, &err))
+    {
+      const page_t *page= root->page.frame;
+      const ulint n_recs= page_get_n_recs(page);
+
+      if (!page_is_leaf(page) && n_recs > 1)
+      {
+        const ulint n_parts= std::min(n_threads, n_recs);
+        const ulint n_fields= dict_index_get_n_unique_in_tree_nonleaf(index);
+        const rec_t *rec= page_get_infimum_rec(page);
+
+        /* The first node pointer carries the minimum record flag;
+        the key ranges start at the node pointers n_recs*k/n_parts. */
+        for (ulint i= 0, k= 1; k < n_parts; i++)
+        {
+          rec= page_rec_get_next_const(rec);
+          if (UNIV_UNLIKELY(!rec || !page_rec_is_user_rec(rec)))
+          {
+            err= DB_CORRUPTION;
+            break;
+          }
+          if (i == n_recs * k / n_parts)
+          {
+            dtuple_t *tuple= dtuple_create(heap, n_fields);
+            dict_index_copy_types(tuple, index, n_fields);
+            rec_copy_prefix_to_dtuple(tuple, rec, index, 0, n_fields, heap);
+            bounds.push_back(tuple);
+            k++;
+          }
+        }
+      }
+    }
+
+    mtr.commit();
+  }
+
+  if (err == DB_SUCCESS)
+  {
+    const size_t n_parts= bounds.size() + 1;
+    std::vector<row_count_part_t> parts(n_parts);
+    std::vector<std::unique_ptr<tpool::waitable_task>> tasks;
+
+    for (size_t i= 0; i < n_parts; i++)
+    {
+      parts[i].prebuilt= prebuilt;
+      parts[i].low= i ? bounds[i - 1] : nullptr;
+      parts[i].high= i < bounds.size() ? bounds[i] : nullptr;
+      parts[i].n_rows= 0;
+      parts[i].err= DB_SUCCESS;
+    }
+
+    for (size_t i= 1; i < n_parts; i++)
+    {
+      tasks.emplace_back(new tpool::waitable_task(row_count_clust_range,
+                                                  &parts[i]));
+      srv_thread_pool->submit_task(tasks.back().get());
+    }
+
+    row_count_clust_range(&parts[0]);
+
+    for (auto &task : tasks)
+      task->wait();
+
+    for (const row_count_part_t &part : parts)
+    {
+      if (part.err != DB_SUCCESS && err == DB_SUCCESS)
+        err= part.err;
+      *n_rows+= part.n_rows;
+    }
+  }
+
+  mem_heap_free(heap);
+  return err;
+}
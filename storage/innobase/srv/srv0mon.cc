@@ -740,6 +740,11 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_PURGE_N_PAGE_HANDLED},
 
+	{"purge_history_freed", "purge",
+	 "Number of transactions removed from the history list by the purge",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_PURGE_HISTORY_FREED},
+
 	{"purge_dml_delay_usec", "purge",
 	 "Microseconds DML to be delayed due to purge lagging",
 	 static_cast<monitor_type_t>(
@@ -978,6 +983,18 @@ static monitor_info_t	innodb_counter_info[] =
 	 "Number of Adaptive Hash Index rows updated",
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_ADAPTIVE_HASH_ROW_UPDATED},
+
+	{"adaptive_hash_index_throttled", "adaptive_hash_index",
+	 "Number of times the Adaptive Hash Index was disabled for an index"
+	 " whose hash entries were updated more often than they were used",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_ADAPTIVE_HASH_INDEX_THROTTLED},
+
+	{"adaptive_hash_index_unthrottled", "adaptive_hash_index",
+	 "Number of times the Adaptive Hash Index was enabled again for an"
+	 " index",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_ADAPTIVE_HASH_INDEX_UNTHROTTLED},
 #endif /* BTR_CUR_HASH_ADAPT */
 
 	/* ========== Counters for tablespace ========== */
@@ -138,6 +138,10 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 my_bool	srv_use_native_aio;
+#ifdef HAVE_URING
+/** innodb_use_native_aio_register */
+my_bool	srv_use_native_aio_register;
+#endif
 my_bool	srv_numa_interleave;
 /** copy of innodb_use_atomic_writes; @see innodb_init_params() */
 my_bool	srv_use_atomic_writes;
@@ -217,6 +221,9 @@ my_bool	srv_random_read_ahead;
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
 ulong	srv_read_ahead_threshold;
+/** innodb_scan_read_ahead_pages; the number of index leaf pages that a
+forward range scan reads ahead, or 0 if disabled */
+ulong	srv_scan_read_ahead_pages;
 
 /** innodb_change_buffer_max_size; maximum on-disk size of change
 buffer in terms of percentage of the buffer pool. */
@@ -977,6 +984,8 @@ srv_export_innodb_status(void)
 
 	export_vars.innodb_data_writes = os_n_file_writes;
 
+	export_vars.innodb_dblwr_pages_bypassed = os_n_atomic_page_writes;
+
 	buf_dblwr.lock();
 	ulint dblwr = buf_dblwr.written();
 	export_vars.innodb_dblwr_pages_written = dblwr;
@@ -1242,6 +1242,10 @@ dberr_t srv_start(bool create_new_db)
 
 	ib::info() << "Completed initialization of buffer pool";
 
+#ifdef HAVE_URING
+	buf_pool.io_register();
+#endif
+
 #ifdef UNIV_DEBUG
 	/* We have observed deadlocks with a 5MB buffer pool but
 	the actual lower limit could very well be a little higher. */
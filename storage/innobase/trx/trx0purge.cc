@@ -518,6 +518,7 @@ inline dberr_t purge_sys_t::iterator::free_history_rseg(trx_rseg_t &rseg) const
   mtr.commit();
   ut_ad(rseg.history_size > 0);
   rseg.history_size--;
+  MONITOR_INC(MONITOR_PURGE_HISTORY_FREED);
   freed= true;
   mtr.start();
   rseg_hdr->page.lock.x_lock();
@@ -1210,19 +1211,22 @@ dict_table_t *purge_sys_t::close_and_reopen(table_id_t id, THD *thd,
 /** Run a purge batch.
 @param n_purge_threads	number of purge threads
 @param thd              purge coordinator thread handle
-@param n_work_items     number of work items (currently tables) to process
+@param n_work_items     number of work items (purge tasks) to process
 @return new purge_sys.head */
 static purge_sys_t::iterator trx_purge_attach_undo_recs(THD *thd,
                                                         ulint *n_work_items)
 {
-  que_thr_t *thr;
   purge_sys_t::iterator head= purge_sys.tail;
 
-  /* Fetch and parse the UNDO records. The UNDO records are added
-  to a per purge node vector. */
-  thr= nullptr;
+  /* Fetch and parse the UNDO records. The UNDO records are collected
+  per table and only then distributed to the purge nodes. Until then,
+  all table handles are kept in the first purge node, so that
+  purge_sys_t::close_and_reopen() will find them. */
+  que_thr_t *thr= UT_LIST_GET_FIRST(purge_sys.query->thrs);
+  purge_node_t *const first_node= static_cast<purge_node_t*>(thr->child);
+  ut_a(que_node_get_type(first_node) == QUE_NODE_PURGE);
 
-  std::unordered_map<table_id_t, purge_node_t *>
+  std::unordered_map<table_id_t, std::vector<trx_purge_rec_t>>
     table_id_map(TRX_PURGE_TABLE_BUCKETS);
   purge_sys.m_active= true;
 
@@ -1254,38 +1258,74 @@ static purge_sys_t::iterator trx_purge_attach_undo_recs(THD *thd,
 
     table_id_t table_id= trx_undo_rec_get_table_id(purge_rec.undo_rec);
 
-    purge_node_t *&table_node= table_id_map[table_id];
-    if (table_node)
-      ut_ad(!table_node->in_progress);
-    if (!table_node)
+    auto t= table_id_map.emplace(table_id, std::vector<trx_purge_rec_t>());
+    if (t.second)
     {
       std::pair<dict_table_t *, MDL_ticket *> p;
       p.first= trx_purge_table_open(table_id, mdl_context, &p.second);
       if (p.first == reinterpret_cast<dict_table_t *>(-1))
         p.first= purge_sys.close_and_reopen(table_id, thd, &p.second);
 
-      if (!thr || !(thr= UT_LIST_GET_NEXT(thrs, thr)))
-        thr= UT_LIST_GET_FIRST(purge_sys.query->thrs);
-      ++*n_work_items;
-      table_node= static_cast<purge_node_t *>(thr->child);
-
-      ut_a(que_node_get_type(table_node) == QUE_NODE_PURGE);
-      ut_d(auto pair=) table_node->tables.emplace(table_id, p);
+      ut_d(auto pair=) first_node->tables.emplace(table_id, p);
       ut_ad(pair.second);
       if (p.first)
         goto enqueue;
     }
-    else if (table_node->tables[table_id].first)
+    else if (first_node->tables[table_id].first)
     {
     enqueue:
-      table_node->undo_recs.push(purge_rec);
-      ut_ad(!table_node->in_progress);
+      t.first->second.push_back(purge_rec);
     }
 
     if (purge_sys.n_pages_handled() >= max_pages)
       break;
   }
 
+  /* Assign the tables to the purge nodes, largest first, each to the
+  node that holds the fewest undo log records so far. The records of
+  one table must be processed in order, so they are never split
+  between nodes. Up to innodb_purge_threads_MAX nodes are used, so that
+  the purge tasks can balance any remaining difference between them. */
+  std::vector<std::pair<size_t, table_id_t>> tables;
+  tables.reserve(table_id_map.size());
+  for (const auto &t : table_id_map)
+    tables.emplace_back(t.second.size(), t.first);
+  std::sort(tables.begin(), tables.end(),
+            std::greater<std::pair<size_t, table_id_t>>());
+
+  const size_t n_nodes=
+    std::min(tables.size(), size_t{innodb_purge_threads_MAX});
+  purge_node_t *nodes[innodb_purge_threads_MAX];
+  std::priority_queue<std::pair<size_t, size_t>,
+                      std::vector<std::pair<size_t, size_t>>,
+                      std::greater<std::pair<size_t, size_t>>> load;
+  for (size_t i= 0; i < n_nodes; i++, thr= UT_LIST_GET_NEXT(thrs, thr))
+  {
+    nodes[i]= static_cast<purge_node_t*>(thr->child);
+    ut_a(que_node_get_type(nodes[i]) == QUE_NODE_PURGE);
+    ut_ad(!nodes[i]->in_progress);
+    load.emplace(0, i);
+  }
+
+  for (const auto &t : tables)
+  {
+    const auto least= load.top();
+    load.pop();
+    purge_node_t *const node= nodes[least.second];
+    if (node != first_node)
+    {
+      auto it= first_node->tables.find(t.second);
+      ut_ad(it != first_node->tables.end());
+      node->tables.emplace(*it);
+      first_node->tables.erase(it);
+    }
+    for (const trx_purge_rec_t &purge_rec : table_id_map[t.second])
+      node->undo_recs.push(purge_rec);
+    load.emplace(least.first + t.first, least.second);
+  }
+
+  *n_work_items= n_nodes;
+
   purge_sys.m_active= false;
 
 #ifdef UNIV_DEBUG
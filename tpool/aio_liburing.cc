@@ -19,11 +19,13 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #include "mysqld_error.h"
 
 #include <liburing.h>
+#include <sys/resource.h>
 
 #include <algorithm>
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <stdexcept>
 
 namespace
@@ -105,38 +107,179 @@ class aio_uring final : public tpool::aio
     std::lock_guard<std::mutex> _(mutex_);
 
     io_uring_sqe *sqe= io_uring_get_sqe(&uring_);
-    if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
-      io_uring_prep_readv(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
-                          cb->m_offset);
+    const int buf_index= find_buffer(cb->m_buffer, cb->m_len);
+    if (buf_index < 0)
+    {
+      if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
+        io_uring_prep_readv(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
+                            cb->m_offset);
+      else
+        io_uring_prep_writev(sqe, cb->m_fh, static_cast<struct iovec *>(cb),
+                             1, cb->m_offset);
+    }
+    else if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
+      io_uring_prep_read_fixed(sqe, cb->m_fh, cb->m_buffer, cb->m_len,
+                               cb->m_offset, buf_index);
     else
-      io_uring_prep_writev(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
-                           cb->m_offset);
-    io_uring_sqe_set_data(sqe, cb);
+      io_uring_prep_write_fixed(sqe, cb->m_fh, cb->m_buffer, cb->m_len,
+                                cb->m_offset, buf_index);
+
+#ifdef TPOOL_HAVE_RW_FLAGS
+    if (cb->m_opcode != tpool::aio_opcode::AIO_PREAD)
+      sqe->rw_flags= cb->m_rw_flags;
+#endif
+
+    /* A bound file is registered in the slot that is equal to its
+    file descriptor, so sqe->fd is already the fixed file index. */
+    if (size_t(cb->m_fh) < fixed_files_.size() && fixed_files_[cb->m_fh])
+      sqe->flags|= IOSQE_FIXED_FILE;
+    /* Tag the requests on registered buffers, so that
+    unregister_buffers_low() can wait for their completion. */
+    if (buf_index >= 0)
+    {
+      fixed_pending_++;
+      io_uring_sqe_set_data(sqe, reinterpret_cast<void*>
+                            (reinterpret_cast<uintptr_t>(cb) | FIXED_BUFFER));
+    }
+    else
+      io_uring_sqe_set_data(sqe, cb);
 
     return io_uring_submit(&uring_) == 1 ? 0 : -1;
   }
 
+  /** Register a file as a fixed file. The file must be unbound
+  before it is closed. */
   int bind(native_file_handle &fd) final
   {
-    std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(it == files_.end() || *it != fd);
-    files_.insert(it, fd);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    std::lock_guard<std::mutex> _(mutex_);
+    if (fixed_files_.empty() && !init_fixed_files())
+      return -1;
+    if (fd < 0 || size_t(fd) >= fixed_files_.size())
+      return -1;
+    assert(!fixed_files_[fd]);
+    int ret= io_uring_register_files_update(&uring_, unsigned(fd), &fd, 1);
+    if (ret != 1)
+      return -1;
+    fixed_files_[fd]= true;
+    return 0;
   }
 
   int unbind(const native_file_handle &fd) final
   {
-    std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(*it == fd);
-    files_.erase(it);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    std::lock_guard<std::mutex> _(mutex_);
+    if (fd < 0 || size_t(fd) >= fixed_files_.size() || !fixed_files_[fd])
+      return 0;
+    fixed_files_[fd]= false;
+    int none= -1;
+    return io_uring_register_files_update(&uring_, unsigned(fd), &none, 1) == 1
+      ? 0 : -1;
+  }
+
+  int register_buffers(const tpool::aio_buffer *bufs, size_t n) final
+  {
+    std::unique_lock<std::mutex> lk(mutex_);
+    unregister_buffers_low(lk);
+
+    std::vector<iovec> iov;
+    for (size_t i= 0; i < n; i++)
+    {
+      /* The kernel refuses to register regions larger than 1 GiB */
+      char *b= static_cast<char*>(bufs[i].m_buffer);
+      for (size_t len= bufs[i].m_len; len; )
+      {
+        const size_t l= std::min<size_t>(len, MAX_FIXED_BUFFER_SIZE);
+        iov.push_back({b, l});
+        b+= l;
+        len-= l;
+      }
+    }
+    std::sort(iov.begin(), iov.end(), [](const iovec &a, const iovec &b)
+              { return a.iov_base < b.iov_base; });
+
+    if (iov.empty())
+      return 0;
+    if (int ret= io_uring_register_buffers(&uring_, iov.data(),
+                                           unsigned(iov.size())))
+    {
+      my_printf_error(ER_UNKNOWN_ERROR,
+                      "io_uring_register_buffers() failed with %d:"
+                      " try larger memory locked limit, ulimit -l"
+                      " (continuing without registered buffers)",
+                      ME_ERROR_LOG | ME_WARNING, ret);
+      return -1;
+    }
+    buffers_.swap(iov);
+    return 0;
+  }
+
+  void unregister_buffers() final
+  {
+    std::unique_lock<std::mutex> lk(mutex_);
+    unregister_buffers_low(lk);
   }
 
 private:
+  /** Tag of io_uring_sqe_set_data() for a request on a registered buffer */
+  static constexpr uintptr_t FIXED_BUFFER= 1;
+  /** Maximum size of a registered buffer */
+  static constexpr size_t MAX_FIXED_BUFFER_SIZE= size_t{1} << 30;
+  /** Maximum size of the fixed file table */
+  static constexpr rlim_t MAX_FIXED_FILES= 65536;
+
+  /** Register an empty fixed file table.
+  @return whether fixed files are available */
+  bool init_fixed_files()
+  {
+    if (fixed_files_failed_)
+      return false;
+    rlimit rl;
+    rlim_t n= MAX_FIXED_FILES;
+    if (!getrlimit(RLIMIT_NOFILE, &rl) && rl.rlim_cur < n)
+      n= rl.rlim_cur;
+    std::vector<int> sparse(size_t(n), -1);
+    if (int ret= io_uring_register_files(&uring_, sparse.data(),
+                                         unsigned(n)))
+    {
+      my_printf_error(ER_UNKNOWN_ERROR,
+                      "io_uring_register_files() failed with %d"
+                      " (continuing without fixed files)",
+                      ME_ERROR_LOG | ME_WARNING, ret);
+      fixed_files_failed_= true;
+      return false;
+    }
+    fixed_files_.resize(size_t(n));
+    return true;
+  }
+
+  /** Unregister the buffers, after waiting for any pending I/O on them.
+  Meanwhile, submit_io() will use unregistered buffers.
+  @param lk  lock on mutex_ */
+  void unregister_buffers_low(std::unique_lock<std::mutex> &lk)
+  {
+    if (buffers_.empty())
+      return;
+    buffers_.clear();
+    fixed_done_.wait(lk, [this] { return !fixed_pending_; });
+    io_uring_unregister_buffers(&uring_);
+  }
+
+  /** Look up a registered buffer.
+  @return index of the registered buffer that contains [buf, buf+len)
+  @retval -1 if there is no such buffer */
+  int find_buffer(const void *buf, size_t len) const
+  {
+    auto it= std::upper_bound(buffers_.begin(), buffers_.end(), buf,
+                              [](const void *b, const iovec &v)
+                              { return b < v.iov_base; });
+    if (it == buffers_.begin())
+      return -1;
+    --it;
+    const char *start= static_cast<const char*>(it->iov_base);
+    if (static_cast<const char*>(buf) + len > start + it->iov_len)
+      return -1;
+    return int(it - buffers_.begin());
+  }
+
   static void thread_routine(aio_uring *aio)
   {
     for (;;)
@@ -152,9 +295,17 @@ class aio_uring final : public tpool::aio
         abort();
       }
 
-      auto *iocb= static_cast<tpool::aiocb*>(io_uring_cqe_get_data(cqe));
+      const uintptr_t data=
+        reinterpret_cast<uintptr_t>(io_uring_cqe_get_data(cqe));
+      auto *iocb= reinterpret_cast<tpool::aiocb*>(data & ~FIXED_BUFFER);
       if (!iocb)
         break; // ~aio_uring() told us to terminate
+      if (data & FIXED_BUFFER)
+      {
+        std::lock_guard<std::mutex> _(aio->mutex_);
+        if (!--aio->fixed_pending_)
+          aio->fixed_done_.notify_all();
+      }
 
       int res= cqe->res;
       if (res < 0)
@@ -188,8 +339,17 @@ class aio_uring final : public tpool::aio
   tpool::thread_pool *tpool_;
   std::thread thread_;
 
-  std::vector<native_file_handle> files_;
-  std::mutex files_mutex_;
+  /** registered buffers, sorted by address; protected by mutex_ */
+  std::vector<iovec> buffers_;
+  /** number of submitted requests on buffers_; protected by mutex_ */
+  size_t fixed_pending_= 0;
+  /** signalled when fixed_pending_ reaches 0 */
+  std::condition_variable fixed_done_;
+  /** whether each slot of the fixed file table is in use;
+  protected by mutex_ */
+  std::vector<bool> fixed_files_;
+  /** whether registering the fixed file table failed */
+  bool fixed_files_failed_= false;
 };
 
 } // namespace
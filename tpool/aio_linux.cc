@@ -163,7 +163,12 @@ class aio_linux final : public aio
     io_prep_pread(static_cast<iocb*>(cb), cb->m_fh, cb->m_buffer, cb->m_len,
                   cb->m_offset);
     if (cb->m_opcode != aio_opcode::AIO_PREAD)
+    {
       cb->aio_lio_opcode= IO_CMD_PWRITE;
+#ifdef TPOOL_HAVE_RW_FLAGS
+      cb->aio_rw_flags= cb->m_rw_flags;
+#endif
+    }
     iocb *icb= static_cast<iocb*>(cb);
     int ret= io_submit(m_io_ctx, 1, &icb);
     if (ret == 1)
@@ -18,6 +18,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #include <condition_variable>
 #include <mutex>
 #include <atomic>
+#include <vector>
+#include <algorithm>
 #include <tpool_structs.h>
 #ifdef LINUX_NATIVE_AIO
 #include <libaio.h>
@@ -25,6 +27,13 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #ifdef HAVE_URING
 #include <sys/uio.h>
 #endif
+#ifdef __linux__
+#include <sys/stat.h>
+# ifdef STATX_WRITE_ATOMIC
+/** aiocb::m_rw_flags can be passed to the kernel (RWF_ATOMIC) */
+#  define TPOOL_HAVE_RW_FLAGS
+# endif
+#endif
 #ifdef _WIN32
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -137,6 +146,9 @@ struct aiocb
   unsigned long long m_offset;
   void *m_buffer;
   unsigned int m_len;
+  /** RWF_ flags of a write, such as RWF_ATOMIC; only
+  used #ifdef TPOOL_HAVE_RW_FLAGS */
+  int m_rw_flags= 0;
   callback_func m_callback;
   task_group* m_group;
   /* Returned length and error code*/
@@ -156,6 +168,13 @@ struct aiocb
 };
 
 
+/** A memory region that is registered with the AIO handler */
+struct aio_buffer
+{
+  void *m_buffer;
+  size_t m_len;
+};
+
 /**
  AIO interface
 */
@@ -167,10 +186,18 @@ class aio
     On completion, cb->m_callback is executed.
   */
   virtual int submit_io(aiocb *cb)= 0;
-  /** "Bind" file to AIO handler (used on Windows only) */
+  /** "Bind" file to AIO handler (Windows; io_uring fixed files) */
   virtual int bind(native_file_handle &fd)= 0;
-  /** "Unind" file to AIO handler (used on Windows only) */
+  /** "Unind" file to AIO handler (Windows; io_uring fixed files) */
   virtual int unbind(const native_file_handle &fd)= 0;
+  /**
+    Register the memory regions that I/O buffers will be allocated from,
+    replacing any previously registered regions.
+    @return 0 on success, nonzero if not supported or on error */
+  virtual int register_buffers(const aio_buffer *, size_t) { return -1; }
+  /** Unregister the regions of register_buffers(), after any pending
+  I/O on them has completed */
+  virtual void unregister_buffers() {}
   virtual ~aio(){};
 protected:
   static void synchronous(aiocb *cb);
@@ -206,6 +233,13 @@ class thread_pool
   /* AIO handler */
   std::unique_ptr<aio> m_aio;
   virtual aio *create_native_aio(int max_io)= 0;
+private:
+  /** Protects m_bound_files, m_buffers and the replacement of m_aio */
+  std::mutex m_aio_registry_mutex;
+  /** Files that are bound to the AIO handler */
+  std::vector<native_file_handle> m_bound_files;
+  /** Memory regions that are registered with the AIO handler */
+  std::vector<aio_buffer> m_buffers;
 
 public:
   /**
@@ -228,16 +262,32 @@ class thread_pool
     m_worker_init_callback= init;
     m_worker_destroy_callback= destroy;
   }
+  /**
+    Create the AIO handler, or replace it with one for a different
+    max_io. The registered buffers and, except on Windows, the bound
+    files are registered with the new handler.
+  */
   int configure_aio(bool use_native_aio, int max_io)
   {
+    std::lock_guard<std::mutex> _(m_aio_registry_mutex);
     if (use_native_aio)
       m_aio.reset(create_native_aio(max_io));
     else
       m_aio.reset(create_simulated_aio(this));
-    return !m_aio ? -1 : 0;
+    if (!m_aio)
+      return -1;
+#ifndef _WIN32
+    /* On Windows, a file stays associated with the old completion port */
+    for (native_file_handle &fd : m_bound_files)
+      m_aio->bind(fd);
+#endif
+    if (!m_buffers.empty())
+      m_aio->register_buffers(m_buffers.data(), m_buffers.size());
+    return 0;
   }
   void disable_aio()
   {
+    std::lock_guard<std::mutex> _(m_aio_registry_mutex);
     m_aio.reset();
   }
 
@@ -258,8 +308,42 @@ class thread_pool
   */
   virtual void set_concurrency(unsigned int threads=0){}
 
-  int bind(native_file_handle &fd) { return m_aio->bind(fd); }
-  void unbind(const native_file_handle &fd) { if (m_aio) m_aio->unbind(fd); }
+  int bind(native_file_handle &fd)
+  {
+    std::lock_guard<std::mutex> _(m_aio_registry_mutex);
+    if (!m_aio)
+      return -1;
+    int ret= m_aio->bind(fd);
+#ifndef _WIN32
+    if (!ret)
+      m_bound_files.push_back(fd);
+#endif
+    return ret;
+  }
+  void unbind(const native_file_handle &fd)
+  {
+    std::lock_guard<std::mutex> _(m_aio_registry_mutex);
+#ifndef _WIN32
+    auto it= std::find(m_bound_files.begin(), m_bound_files.end(), fd);
+    if (it != m_bound_files.end())
+      m_bound_files.erase(it);
+#endif
+    if (m_aio)
+      m_aio->unbind(fd);
+  }
+  int register_buffers(const aio_buffer *bufs, size_t n)
+  {
+    std::lock_guard<std::mutex> _(m_aio_registry_mutex);
+    m_buffers.assign(bufs, bufs + n);
+    return m_aio ? m_aio->register_buffers(bufs, n) : -1;
+  }
+  void unregister_buffers()
+  {
+    std::lock_guard<std::mutex> _(m_aio_registry_mutex);
+    m_buffers.clear();
+    if (m_aio)
+      m_aio->unregister_buffers();
+  }
   int submit_io(aiocb *cb) { return m_aio->submit_io(cb); }
   virtual void wait_begin() {};
   virtual void wait_end() {};
@@ -28,6 +28,9 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #include <thread>
 #include <vector>
 #include "tpool.h"
+#ifdef TPOOL_HAVE_RW_FLAGS
+# include <sys/uio.h> /* pwritev2() */
+#endif
 #include <assert.h>
 #include <my_global.h>
 #include <my_dbug.h>
@@ -69,6 +72,14 @@ void aio::synchronous(aiocb *cb)
     ret_len= pread(cb->m_fh, cb->m_buffer, cb->m_len, cb->m_offset);
     break;
   case aio_opcode::AIO_PWRITE:
+#ifdef TPOOL_HAVE_RW_FLAGS
+    if (cb->m_rw_flags)
+    {
+      iovec iov{cb->m_buffer, cb->m_len};
+      ret_len= pwritev2(cb->m_fh, &iov, 1, cb->m_offset, cb->m_rw_flags);
+      break;
+    }
+#endif
     ret_len= pwrite(cb->m_fh, cb->m_buffer, cb->m_len, cb->m_offset);
     break;
   default:
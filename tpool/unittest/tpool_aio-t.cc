@@ -0,0 +1,127 @@
+/* Copyright (c) 2026, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/* The buffers and files that are registered with the AIO handler of
+tpool::thread_pool must be registered again when configure_aio()
+replaces the handler, for example with a different max_io. A file
+that could not be bound is not remembered. */
+
+#include "tap.h"
+#include "my_sys.h"
+#include "tpool.h"
+
+#ifdef HAVE_PSI_INTERFACE
+mysql_pfs_key_t tpool_cache_mutex_key;
+#endif
+
+/** AIO handler that records what is registered with it */
+class registry_aio : public tpool::aio
+{
+public:
+  int max_io;
+  std::vector<native_file_handle> files;
+  std::vector<tpool::aio_buffer> buffers;
+  /** the file that bind() refuses */
+  native_file_handle unbindable;
+
+  explicit registry_aio(int max_io) : max_io(max_io), unbindable() {}
+
+  int submit_io(tpool::aiocb *) override { return -1; }
+  int bind(native_file_handle &fd) override
+  {
+    if (fd == unbindable)
+      return -1;
+    files.push_back(fd);
+    return 0;
+  }
+  int unbind(const native_file_handle &fd) override
+  {
+    auto it= std::find(files.begin(), files.end(), fd);
+    if (it != files.end())
+      files.erase(it);
+    return 0;
+  }
+  int register_buffers(const tpool::aio_buffer *bufs, size_t n) override
+  {
+    buffers.assign(bufs, bufs + n);
+    return 0;
+  }
+  void unregister_buffers() override { buffers.clear(); }
+};
+
+class registry_pool : public tpool::thread_pool
+{
+public:
+  void submit_task(tpool::task *) override {}
+  tpool::timer *create_timer(tpool::callback_func, void *) override
+  { return nullptr; }
+  registry_aio *get_aio() const
+  { return static_cast<registry_aio*>(m_aio.get()); }
+protected:
+  tpool::aio *create_native_aio(int max_io) override
+  { return new registry_aio(max_io); }
+};
+
+int main(int, char **argv)
+{
+  MY_INIT(argv[0]);
+  plan(7);
+
+  static char chunk1[4096], chunk2[4096];
+  const tpool::aio_buffer bufs[]= {{chunk1, sizeof chunk1},
+                                   {chunk2, sizeof chunk2}};
+#ifdef _WIN32
+  native_file_handle f1, f2;
+#else
+  native_file_handle f1= 10, f2= 11, f3= 12;
+#endif
+
+  registry_pool pool;
+  ok(!pool.configure_aio(true, 64), "configure_aio");
+  pool.bind(f1);
+  pool.bind(f2);
+  pool.unbind(f1);
+#ifdef _WIN32
+  skip(1, "bound files are not remembered on Windows");
+#else
+  pool.get_aio()->unbindable= f3;
+  ok(pool.bind(f3) && pool.get_aio()->files.size() == 1,
+     "a file that could not be bound is not remembered");
+#endif
+  pool.register_buffers(bufs, 2);
+
+  ok(!pool.configure_aio(true, 256) && pool.get_aio()->max_io == 256,
+     "configure_aio replaces the handler");
+  ok(pool.get_aio()->buffers.size() == 2 &&
+     pool.get_aio()->buffers[0].m_buffer == chunk1 &&
+     pool.get_aio()->buffers[1].m_buffer == chunk2,
+     "buffers are registered with the new handler");
+#ifdef _WIN32
+  ok(pool.get_aio()->files.empty(), "files stay on the old completion port");
+#else
+  ok(pool.get_aio()->files.size() == 1 && pool.get_aio()->files[0] == f2,
+     "bound files are bound to the new handler");
+#endif
+
+  pool.unregister_buffers();
+  pool.unbind(f2);
+  ok(!pool.configure_aio(true, 64), "configure_aio");
+  ok(pool.get_aio()->buffers.empty() && pool.get_aio()->files.empty(),
+     "unregistered buffers and files are forgotten");
+  pool.disable_aio();
+
+  my_end(MY_CHECK_ERROR);
+  return exit_status();
+}
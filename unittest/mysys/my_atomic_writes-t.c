@@ -0,0 +1,75 @@
+/* Copyright (c) 2026, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/* my_atomic_write_flags() must only return RWF_ATOMIC when the kernel
+guarantees untorn writes of the page size for the file. */
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include "tap.h"
+
+#define PAGE_SIZE 16384
+
+/** @return whether statx() reports untorn writes of PAGE_SIZE */
+static my_bool statx_write_atomic(int fd)
+{
+#ifdef STATX_WRITE_ATOMIC
+  struct statx st;
+  return !statx(fd, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &st) &&
+    (st.stx_mask & STATX_WRITE_ATOMIC) &&
+    (st.stx_attributes & STATX_ATTR_WRITE_ATOMIC) &&
+    st.stx_atomic_write_unit_min <= PAGE_SIZE &&
+    st.stx_atomic_write_unit_max >= PAGE_SIZE;
+#else
+  (void) fd;
+  return 0;
+#endif
+}
+
+int main(int argc __attribute__((unused)), char *argv[])
+{
+  char name[]= "/tmp/my_atomic_writes-t.XXXXXX";
+  int fd;
+
+  MY_INIT(argv[0]);
+  plan(4);
+
+  fd= mkstemp(name);
+  ok(fd >= 0, "create temp file");
+  ok(fd >= 0 && !my_atomic_write_flags(fd, PAGE_SIZE),
+     "no atomic writes without O_DIRECT");
+  if (fd >= 0)
+    close(fd);
+
+  fd= open(name, O_RDWR | O_DIRECT);
+  if (fd < 0)
+    skip(2, "O_DIRECT is not supported in /tmp");
+  else
+  {
+    int flags= my_atomic_write_flags(fd, PAGE_SIZE);
+    ok(!my_atomic_write_flags(fd, PAGE_SIZE + 512),
+       "no atomic writes of a size that is not a power of 2");
+    ok(statx_write_atomic(fd) ? flags == 0x40 /* RWF_ATOMIC */ : !flags,
+       "RWF_ATOMIC if and only if statx() reports untorn %d-byte writes",
+       PAGE_SIZE);
+    close(fd);
+  }
+
+  unlink(name);
+  my_end(0);
+  return exit_status();
+}
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2024, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA */
+
+#include "mariadb.h"
+#include <my_sys.h>
+#include <tap.h>
+#include "filesort_utils.h"
+
+/*
+  Unit tests for prefix_sort_str_ptr(). The result is compared with the
+  my_qsort2() sort that is used for keys which cannot be sorted by their
+  prefixes, and the time taken by both is reported for several key widths.
+*/
+
+static const uint n_keys= 200000;
+
+static uint32 rnd_state= 1;
+static uint32 rnd()
+{
+  rnd_state= rnd_state * 1103515245 + 12345;
+  return rnd_state >> 16;
+}
+
+static void test_width(size_t width, uint alphabet)
+{
+  uchar *keys= (uchar*) my_malloc(PSI_NOT_INSTRUMENTED, n_keys * width,
+                                  MYF(MY_FAE));
+  uchar **ptrs1= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                     n_keys * sizeof(uchar*), MYF(MY_FAE));
+  uchar **ptrs2= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                     n_keys * sizeof(uchar*), MYF(MY_FAE));
+  Sort_key_prefix *buffer= (Sort_key_prefix*)
+    my_malloc(PSI_NOT_INSTRUMENTED, n_keys * sizeof(Sort_key_prefix),
+              MYF(MY_FAE));
+
+  /*
+    A small alphabet makes many keys share their prefix, so that the
+    comparison of the key suffixes is exercised too.
+  */
+  for (uint i= 0; i < n_keys; i++)
+  {
+    uchar *key= keys + i * width;
+    for (size_t j= 0; j < width; j++)
+      key[j]= (uchar) (rnd() % alphabet);
+    ptrs1[i]= ptrs2[i]= key;
+  }
+
+  ulonglong start= my_interval_timer();
+  my_qsort2(ptrs1, n_keys, sizeof(uchar*), get_ptr_compare(width), &width);
+  ulonglong qsort_time= my_interval_timer() - start;
+
+  start= my_interval_timer();
+  prefix_sort_str_ptr(ptrs2, n_keys, width, buffer);
+  ulonglong prefix_time= my_interval_timer() - start;
+
+  bool same= true, sorted= true;
+  for (uint i= 0; i < n_keys; i++)
+  {
+    same&= !memcmp(ptrs1[i], ptrs2[i], width);
+    if (i)
+      sorted&= memcmp(ptrs2[i - 1], ptrs2[i], width) <= 0;
+  }
+  ok(same && sorted, "width %u alphabet %u: keys sorted", (uint) width,
+     alphabet);
+  diag("width %u: my_qsort2 %llu us, prefix_sort_str_ptr %llu us",
+       (uint) width, qsort_time / 1000, prefix_time / 1000);
+
+  my_free(buffer);
+  my_free(ptrs2);
+  my_free(ptrs1);
+  my_free(keys);
+}
+
+int main(int args, char **argv)
+{
+  MY_INIT(argv[0]);
+
+  plan(NO_PLAN);
+  diag("Testing prefix_sort_str_ptr");
+
+  static const size_t widths[]= {4, 8, 12, 24, 64, 256};
+  for (size_t width : widths)
+  {
+    test_width(width, 256);
+    test_width(width, 2);
+  }
+
+  diag("Done");
+
+  my_end(MY_CHECK_ERROR);
+  return exit_status();
+}